@@ -1,4 +1,6 @@
 #include <libretro.h>
+#include <stdint.h>
+#include <string.h>
 #include <string>
 #include "ChaiLove.h"
 #include "pntr_app.h"
@@ -38,6 +40,9 @@ void ChaiLove::quit(void) {
 	// Enforce the should close flag.
 	event.m_shouldclose = true;
 
+	// Finish the file requests while their callbacks can still run.
+	filesystem.finishRequests();
+
 	// Disengage the scripting language.
 	if (script) {
 		script->exit();
@@ -46,6 +51,9 @@ void ChaiLove::quit(void) {
 	}
 
 	// Unload all the other sub-systems.
+	replay.unload();
+	ecs.unload();
+	data.unload();
 	joystick.unload();
 	font.unload();
 	image.unload();
@@ -83,6 +91,10 @@ bool ChaiLove::load(const std::string& file, const void* data, unsigned int data
 	script->conf(config);
 	system.load(config);
 
+	// Set up how savestates are encoded.
+	this->data.getSavestateEncoder().setDelta(config.options["savestatedelta"]);
+	this->data.getSavestateEncoder().setCompress(config.options["savestatecompress"]);
+
 	// Load up the window dimensions.
 	window.load(app, config);
 
@@ -104,9 +116,17 @@ void ChaiLove::update() {
 	// Update and poll all the events.
 	event.update();
 
+	// Take the state of the keys, buttons and input actions for this frame.
+	keyboard.update();
+	joystick.update();
+	input.update();
+
+	// Hand back the background file requests that have finished.
+	filesystem.update();
+
 	// Step forward the timer, and update the game.
 	if (script != NULL) {
-		script->update(pntr_app_delta_time(app));
+		script->update(timer.getDelta());
 	}
 }
 
@@ -132,6 +152,9 @@ void ChaiLove::draw() {
 	if (script != NULL) {
 		script->draw();
 	}
+
+	// Let the replay hash the rendered frame.
+	replay.endFrame(screen, timer.getDelta());
 }
 
 /**
@@ -154,6 +177,119 @@ bool ChaiLove::loadstate(const std::string& data) {
 	return false;
 }
 
+/**
+ * Savestates are stored as the size of the state, followed by the state itself, whether it comes from serialize() or savestate().
+ *
+ * With the "savestatedelta" or "savestatecompress" options, the state is encoded by the SavestateEncoder.
+ */
+void ChaiLove::takeState() {
+	m_state.clear();
+	if (script->hasSerializeCallback()) {
+		script->serialize(m_state);
+	} else {
+		std::string state = savestate();
+		m_state.write(state.data(), state.size());
+	}
+}
+
+size_t ChaiLove::getSerializeSize() {
+	if (m_serializeSize == 0 && script != NULL) {
+		// The size can't change afterwards, so use the largest state the game declared, or leave room for the state to grow.
+		size_t size;
+		if (config.savestateSize > 0) {
+			size = static_cast<size_t>(config.savestateSize);
+		} else {
+			takeState();
+			size = m_state.getSize() * 2;
+		}
+		size += sizeof(uint32_t);
+		if (data.getSavestateEncoder().isEnabled()) {
+			size += love::Types::Data::SavestateEncoder::HEADER_SIZE;
+		}
+		m_serializeSize = (size + 1023) / 1024 * 1024;
+	}
+	return m_serializeSize;
+}
+
+bool ChaiLove::serialize(void* output, size_t size) {
+	love::Types::Data::SavestateEncoder& encoder = data.getSavestateEncoder();
+	if (script == NULL || output == NULL) {
+		return false;
+	}
+
+	uint8_t* buffer = static_cast<uint8_t*>(output);
+	takeState();
+	if (!script->hasSerializeCallback() && m_state.getSize() == 0) {
+		// There is no savestate() to save.
+		return false;
+	}
+
+	love::Types::Data::ByteData* state = &m_state;
+	if (encoder.isEnabled()) {
+		encoder.encode(m_state.getPointer(), m_state.getSize(), m_encoded);
+		state = &m_encoded;
+	}
+
+	uint32_t stateSize = static_cast<uint32_t>(state->getSize());
+	if (sizeof(stateSize) + stateSize > size) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] Savestate of %u bytes does not fit in %u bytes. Set t.savestateSize in conf() to the largest state the game needs.", stateSize, static_cast<unsigned int>(size));
+		return false;
+	}
+
+	// Clear the rest of the buffer, so that it doesn't hold anything from previous states.
+	memcpy(buffer, &stateSize, sizeof(stateSize));
+	memcpy(buffer + sizeof(stateSize), state->getPointer(), stateSize);
+	memset(buffer + sizeof(stateSize) + stateSize, 0, size - sizeof(stateSize) - stateSize);
+	return true;
+}
+
+bool ChaiLove::unserialize(const void* input, size_t size) {
+	love::Types::Data::SavestateEncoder& encoder = data.getSavestateEncoder();
+	if (script == NULL || input == NULL) {
+		return false;
+	}
+
+	// Every state starts with its size, as the frontend's buffer is padded with zeros past it.
+	const uint8_t* buffer = static_cast<const uint8_t*>(input);
+	if (size < sizeof(uint32_t)) {
+		return false;
+	}
+
+	uint32_t stateSize;
+	memcpy(&stateSize, buffer, sizeof(stateSize));
+	if (stateSize > size - sizeof(stateSize) && !script->hasSerializeCallback() && !encoder.isEnabled()) {
+		// States from before the size header are savestate() text padded with zeros, so their first bytes read as an impossible size.
+		const void* end = memchr(buffer, 0, size);
+		size_t length = end != NULL ? static_cast<const uint8_t*>(end) - buffer : size;
+		return loadstate(std::string(reinterpret_cast<const char*>(buffer), length));
+	}
+	if (stateSize > size - sizeof(stateSize)) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] Savestate of %u bytes is larger than its %u byte buffer.", stateSize, static_cast<unsigned int>(size));
+		return false;
+	}
+
+	// Copy the state out of the frontend's buffer, as the script may keep the ByteData after the callback returns.
+	if (encoder.isEnabled()) {
+		if (!encoder.decode(buffer + sizeof(stateSize), stateSize, m_state)) {
+			window.showMessageBox(encoder.getError());
+			return false;
+		}
+	} else {
+		m_state.clear();
+		m_state.write(buffer + sizeof(stateSize), stateSize);
+		m_state.seek(0);
+	}
+
+	bool result;
+	if (script->hasSerializeCallback()) {
+		result = script->unserialize(m_state);
+	} else {
+		result = loadstate(m_state.getString());
+	}
+	m_state.clear();
+	return result;
+}
+
 /**
  * Invoke the script cheatreset hook.
  */
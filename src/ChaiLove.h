@@ -71,6 +71,9 @@
 #include "love/window.h"
 #include "love/math.h"
 #include "love/event.h"
+#include "love/replay.h"
+#include "love/ecs.h"
+#include "love/input.h"
 
 class ChaiLove {
 	public:
@@ -99,6 +102,9 @@ class ChaiLove {
 	love::math math;
 	love::window window;
 	love::event event;
+	love::replay replay;
+	love::ecs ecs;
+	love::input input;
 
 	~ChaiLove();
 	void quit(void);
@@ -108,11 +114,45 @@ class ChaiLove {
 	void reset();
 	std::string savestate();
 	bool loadstate(const std::string& data);
+
+	/**
+	 * Gets the size of the buffer that the frontend needs to hold a savestate.
+	 */
+	size_t getSerializeSize();
+
+	/**
+	 * Writes the state from the script's serialize() or savestate() directly into the given buffer.
+	 *
+	 * The state is prefixed with its size, so that unserialize() can ignore the padding after it.
+	 *
+	 * @return False if there is no state, or it doesn't fit.
+	 */
+	bool serialize(void* output, size_t size);
+
+	/**
+	 * Passes the given buffer to the script's unserialize() or loadstate().
+	 *
+	 * @return False if the state was invalid, or the script failed to load it.
+	 */
+	bool unserialize(const void* input, size_t size);
 	void cheatreset();
 	void cheatset(int index, bool enabled, const std::string& code);
 
 	pntr_image* screen = NULL;
 	pntr_app* app = NULL;
+
+	private:
+	/**
+	 * Asks the script for its state, with serialize() or savestate(), and keeps it in m_state.
+	 */
+	void takeState();
+
+	/**
+	 * The buffers that the state is serialized and encoded into, kept between frames to avoid reallocating.
+	 */
+	love::Types::Data::ByteData m_state;
+	love::Types::Data::ByteData m_encoded;
+	size_t m_serializeSize = 0;
 };
 
 #endif  // SRC_CHAILOVE_H_
@@ -1,6 +1,7 @@
 #include "SoundData.h"
 #include <string>
 #include <stdlib.h>
+#include <string.h>
 
 #include "../../../ChaiLove.h"
 
@@ -14,6 +15,31 @@ SoundData::SoundData(const std::string& filename) {
 	m_sound = pntr_load_sound(filename.c_str());
 }
 
+SoundData::SoundData(FileData& data) {
+	const unsigned char* buffer = data.getPointer();
+	if (buffer == NULL || data.getSize() <= 0) {
+		return;
+	}
+
+	pntr_app_sound_type type = PNTR_APP_SOUND_TYPE_UNKNOWN;
+	std::string extension = data.getExtension();
+	if (extension == "wav") {
+		type = PNTR_APP_SOUND_TYPE_WAV;
+	} else if (extension == "ogg") {
+		type = PNTR_APP_SOUND_TYPE_OGG;
+	}
+
+	// The sound takes ownership of the memory it's given, so it needs its own copy of the FileData's buffer.
+	unsigned int size = static_cast<unsigned int>(data.getSize());
+	unsigned char* copy = static_cast<unsigned char*>(pntr_load_memory(size));
+	if (copy == NULL) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] Not enough memory to load sound: %s", data.getFilename().c_str());
+		return;
+	}
+	memcpy(copy, buffer, size);
+	m_sound = pntr_load_sound_from_memory(type, copy, size);
+}
+
 SoundData::~SoundData() {
 	unload();
 }
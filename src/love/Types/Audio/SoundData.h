@@ -5,6 +5,9 @@
 #include "audio/audio_mixer.h"
 
 #include "pntr_app.h"
+#include "../FileSystem/FileData.h"
+
+using love::Types::FileSystem::FileData;
 
 namespace love {
 namespace Types {
@@ -16,6 +19,11 @@ namespace Audio {
 class SoundData {
 	public:
 	SoundData(const std::string& filename);
+
+	/**
+	 * Loads the sound from the contents of the given FileData. The format is chosen from its extension.
+	 */
+	SoundData(FileData& data);
 	~SoundData();
 
 	/**
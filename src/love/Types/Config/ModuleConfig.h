@@ -8,13 +8,102 @@ namespace Config {
 /**
  * Allows enabling or disiabling modules during initialization.
  *
+ * Disabled modules are left out of the love namespace, and their functions and types are not registered with the script, which reduces the startup time and memory use. Modules can only be disabled from a conf(t) defined in conf.chai, as it is run before the modules are registered; a conf(t) defined with the main module logs a warning instead.
+ *
+ * @code
+ * def conf(t) {
+ *   t.modules.joystick = false
+ *   t.modules.replay = false
+ * }
+ * @endcode
+ *
  * @see https://love2d.org/wiki/Config_Files
  */
 struct ModuleConfig {
+	/**
+	 * Enable or disable the audio module.
+	 */
+	bool audio = true;
+
+	/**
+	 * Enable or disable the data module.
+	 */
+	bool data = true;
+
+	/**
+	 * Enable or disable the ecs module.
+	 */
+	bool ecs = true;
+
+	/**
+	 * Enable or disable the event module.
+	 */
+	bool event = true;
+
+	/**
+	 * Enable or disable the font module.
+	 */
+	bool font = true;
+
+	/**
+	 * Enable or disable the graphics module.
+	 */
+	bool graphics = true;
+
+	/**
+	 * Enable or disable the image module.
+	 */
+	bool image = true;
+
+	/**
+	 * Enable or disable the input module.
+	 */
+	bool input = true;
+
+	/**
+	 * Enable or disable the joystick module.
+	 */
+	bool joystick = true;
+
+	/**
+	 * Enable or disable the keyboard module.
+	 */
+	bool keyboard = true;
+
+	/**
+	 * Enable or disable the math module.
+	 */
+	bool math = true;
+
+	/**
+	 * Enable or disable the mouse module.
+	 */
+	bool mouse = true;
+
+	/**
+	 * Enable or disable the replay module.
+	 */
+	bool replay = true;
+
 	/**
 	 * Enable or disable the sound module.
 	 */
 	bool sound = true;
+
+	/**
+	 * Enable or disable the system module.
+	 */
+	bool system = true;
+
+	/**
+	 * Enable or disable the timer module.
+	 */
+	bool timer = true;
+
+	/**
+	 * Enable or disable the window module.
+	 */
+	bool window = true;
 };
 
 }  // namespace Config
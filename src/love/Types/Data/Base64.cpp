@@ -0,0 +1,174 @@
+#include "Base64.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BASE64_SSSE3
+#include <tmmintrin.h>
+#endif
+
+namespace love {
+namespace Types {
+namespace Data {
+
+namespace {
+
+const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/**
+ * Maps each character to its 6-bit value, or 0xFF for characters outside the alphabet.
+ */
+struct DecodeTable {
+	uint8_t values[256];
+
+	DecodeTable() {
+		memset(values, 0xFF, sizeof(values));
+		for (int i = 0; i < 64; i++) {
+			values[static_cast<uint8_t>(ALPHABET[i])] = static_cast<uint8_t>(i);
+		}
+	}
+};
+
+const DecodeTable DECODE_TABLE;
+
+inline void encodeTriple(const uint8_t* source, char* destination) {
+	uint32_t triple = (static_cast<uint32_t>(source[0]) << 16) | (static_cast<uint32_t>(source[1]) << 8) | source[2];
+	destination[0] = ALPHABET[(triple >> 18) & 0x3F];
+	destination[1] = ALPHABET[(triple >> 12) & 0x3F];
+	destination[2] = ALPHABET[(triple >> 6) & 0x3F];
+	destination[3] = ALPHABET[triple & 0x3F];
+}
+
+#ifdef BASE64_SSSE3
+/**
+ * Encodes 12 bytes at a time, reading 16. Returns the number of bytes encoded.
+ *
+ * The bytes are split into 6-bit indices with shuffles and multiplies, and the indices are turned into characters by adding an offset looked up from their range.
+ */
+__attribute__((target("ssse3")))
+size_t encodeSSSE3(const uint8_t* source, size_t size, char* destination) {
+	const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+	const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+	size_t done = 0;
+	while (size - done >= 16) {
+		__m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + done));
+		input = _mm_shuffle_epi8(input, shuffle);
+
+		// Move each group of 6 bits into its own byte.
+		__m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+		__m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+		__m128i indices = _mm_or_si128(high, low);
+
+		// 0-25 use offset 13, 26-51 use 0, 52-61 use 1-10, and 62 and 63 use 11 and 12.
+		__m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+		__m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+		range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+		__m128i output = _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), output);
+		destination += 16;
+		done += 12;
+	}
+	return done;
+}
+
+bool hasSSSE3() {
+	static const bool supported = __builtin_cpu_supports("ssse3");
+	return supported;
+}
+#endif
+
+}  // namespace
+
+size_t Base64::getEncodedSize(size_t size) {
+	return (size + 2) / 3 * 4;
+}
+
+void Base64::encode(const uint8_t* source, size_t size, char* destination) {
+	size_t done = 0;
+	#ifdef BASE64_SSSE3
+	if (hasSSSE3()) {
+		done = encodeSSSE3(source, size, destination);
+		destination += done / 3 * 4;
+	}
+	#endif
+
+	for (; size - done >= 3; done += 3) {
+		encodeTriple(source + done, destination);
+		destination += 4;
+	}
+
+	// Pad out the last group.
+	size_t remaining = size - done;
+	if (remaining > 0) {
+		uint8_t last[3] = {0, 0, 0};
+		memcpy(last, source + done, remaining);
+		encodeTriple(last, destination);
+		destination[3] = '=';
+		if (remaining == 1) {
+			destination[2] = '=';
+		}
+	}
+}
+
+size_t Base64::getDecodedSize(size_t size) {
+	return (size + 3) / 4 * 3;
+}
+
+bool Base64::decode(const char* source, size_t size, uint8_t* destination, size_t* decodedSize) {
+	const uint8_t* input = reinterpret_cast<const uint8_t*>(source);
+	const uint8_t* values = DECODE_TABLE.values;
+	uint8_t* output = destination;
+
+	// The padding is optional, so drop it and work out the last group from the size.
+	if (size > 0 && source[size - 1] == '=') {
+		size--;
+		if (size > 0 && source[size - 1] == '=') {
+			size--;
+		}
+	}
+	if (size % 4 == 1) {
+		return false;
+	}
+
+	const uint8_t* end = input + size / 4 * 4;
+	while (input < end) {
+		uint32_t a = values[input[0]];
+		uint32_t b = values[input[1]];
+		uint32_t c = values[input[2]];
+		uint32_t d = values[input[3]];
+		if ((a | b | c | d) & 0x80) {
+			return false;
+		}
+		uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+		output[0] = static_cast<uint8_t>(triple >> 16);
+		output[1] = static_cast<uint8_t>(triple >> 8);
+		output[2] = static_cast<uint8_t>(triple);
+		input += 4;
+		output += 3;
+	}
+
+	size_t remaining = size % 4;
+	if (remaining > 0) {
+		uint32_t a = values[input[0]];
+		uint32_t b = values[input[1]];
+		uint32_t c = remaining == 3 ? values[input[2]] : 0;
+		if ((a | b | c) & 0x80) {
+			return false;
+		}
+		uint32_t triple = (a << 18) | (b << 12) | (c << 6);
+		*output++ = static_cast<uint8_t>(triple >> 16);
+		if (remaining == 3) {
+			*output++ = static_cast<uint8_t>(triple >> 8);
+		}
+	}
+
+	*decodedSize = static_cast<size_t>(output - destination);
+	return true;
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
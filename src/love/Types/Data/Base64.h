@@ -0,0 +1,56 @@
+#ifndef SRC_LOVE_TYPES_DATA_BASE64_H_
+#define SRC_LOVE_TYPES_DATA_BASE64_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * Encodes and decodes the standard base64 alphabet from RFC 4648, writing straight into a buffer of the right size.
+ *
+ * On x86 processors with SSSE3, encoding handles 12 bytes at a time.
+ *
+ * @see love.data.encode
+ */
+class Base64 {
+	public:
+	/**
+	 * Gets the size of the encoded form of the given number of bytes, including padding.
+	 */
+	static size_t getEncodedSize(size_t size);
+
+	/**
+	 * Encodes the given bytes.
+	 *
+	 * @param source The bytes to encode.
+	 * @param size The number of bytes to encode.
+	 * @param destination Receives the encoded characters. Must hold getEncodedSize(size) bytes.
+	 */
+	static void encode(const uint8_t* source, size_t size, char* destination);
+
+	/**
+	 * Gets the largest number of bytes that the given number of characters can decode to.
+	 */
+	static size_t getDecodedSize(size_t size);
+
+	/**
+	 * Decodes the given characters. The padding at the end is optional.
+	 *
+	 * @param source The characters to decode.
+	 * @param size The number of characters.
+	 * @param destination Receives the decoded bytes. Must hold getDecodedSize(size) bytes.
+	 * @param decodedSize Receives the number of decoded bytes.
+	 *
+	 * @return False if the characters aren't valid base64.
+	 */
+	static bool decode(const char* source, size_t size, uint8_t* destination, size_t* decodedSize);
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_BASE64_H_
@@ -0,0 +1,350 @@
+#include "ByteData.h"
+#include <stdint.h>
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace love {
+namespace Types {
+namespace Data {
+
+ByteData::ByteData() : m_buffer(std::make_shared<std::vector<uint8_t> >()) {
+}
+
+ByteData::ByteData(int capacity) : m_buffer(std::make_shared<std::vector<uint8_t> >()) {
+	if (capacity > 0) {
+		m_buffer->reserve(capacity);
+	}
+}
+
+ByteData::ByteData(const std::string& contents) : m_buffer(std::make_shared<std::vector<uint8_t> >(contents.begin(), contents.end())), m_size(contents.size()) {
+}
+
+void ByteData::wrap(const void* data, size_t size) {
+	clear();
+	m_data = static_cast<const uint8_t*>(data);
+	m_size = data == NULL ? 0 : size;
+}
+
+bool ByteData::own() {
+	if (m_data != NULL) {
+		// A copy would stop sharing its bytes with the ByteData it's a view of.
+		if (m_view) {
+			return false;
+		}
+		m_buffer = std::make_shared<std::vector<uint8_t> >(m_data, m_data + m_size);
+		m_data = NULL;
+		m_offset = 0;
+	}
+	return true;
+}
+
+uint8_t* ByteData::getWritePointer() {
+	if (!own()) {
+		return NULL;
+	}
+	return m_buffer->data() + m_offset;
+}
+
+ByteData& ByteData::clear() {
+	// Leave the bytes alone if anything else is using them.
+	if (m_view || m_buffer.use_count() > 1) {
+		m_buffer = std::make_shared<std::vector<uint8_t> >();
+	} else {
+		m_buffer->clear();
+	}
+	m_data = NULL;
+	m_offset = 0;
+	m_size = 0;
+	m_position = 0;
+	m_view = false;
+	return *this;
+}
+
+bool ByteData::resize(int size) {
+	if (m_view || size < 0 || !own()) {
+		return false;
+	}
+
+	// The buffer is never shrunk, as views may still point into it.
+	size_t newSize = size;
+	if (newSize > m_buffer->size()) {
+		m_buffer->resize(newSize, 0);
+	}
+	if (newSize > m_size) {
+		memset(m_buffer->data() + m_size, 0, newSize - m_size);
+	}
+	m_size = newSize;
+	if (m_position > m_size) {
+		m_position = m_size;
+	}
+	return true;
+}
+
+int ByteData::getSize() {
+	return static_cast<int>(m_size);
+}
+
+std::string ByteData::getString() {
+	const uint8_t* data = getPointer();
+	return std::string(reinterpret_cast<const char*>(data), m_size);
+}
+
+const uint8_t* ByteData::getPointer() {
+	return m_data != NULL ? m_data : m_buffer->data() + m_offset;
+}
+
+ByteData ByteData::getView(int offset) {
+	return getView(offset, -1);
+}
+
+ByteData ByteData::getView(int offset, int size) {
+	if (offset < 0 || static_cast<size_t>(offset) > m_size) {
+		offset = static_cast<int>(m_size);
+	}
+	if (size < 0 || static_cast<size_t>(size) > m_size - offset) {
+		size = static_cast<int>(m_size - offset);
+	}
+
+	ByteData view;
+	if (m_data != NULL) {
+		view.wrap(m_data + offset, size);
+	} else {
+		view.m_buffer = m_buffer;
+		view.m_offset = m_offset + offset;
+		view.m_size = size;
+	}
+	view.m_view = true;
+	return view;
+}
+
+ByteData ByteData::clone() {
+	const uint8_t* data = getPointer();
+	ByteData copy;
+	copy.m_buffer->assign(data, data + m_size);
+	copy.m_size = m_size;
+	copy.m_position = m_position;
+	return copy;
+}
+
+int ByteData::tell() {
+	return static_cast<int>(m_position);
+}
+
+bool ByteData::seek(int position) {
+	if (position < 0 || static_cast<size_t>(position) > m_size) {
+		return false;
+	}
+	m_position = position;
+	return true;
+}
+
+bool ByteData::isEOF() {
+	return m_position >= m_size;
+}
+
+ByteData& ByteData::write(const void* data, size_t size) {
+	size_t end = m_position + size;
+	if (!own() || (m_view && end > m_size)) {
+		// Views can't grow past the bytes they share.
+		m_position = m_size;
+		return *this;
+	}
+	if (m_offset + end > m_buffer->size()) {
+		m_buffer->resize(m_offset + end);
+	}
+	memcpy(m_buffer->data() + m_offset + m_position, data, size);
+	m_position = end;
+	if (end > m_size) {
+		m_size = end;
+	}
+	return *this;
+}
+
+ByteData& ByteData::writeByte(int value) {
+	uint8_t byte = static_cast<uint8_t>(value);
+	return write(&byte, sizeof(byte));
+}
+
+ByteData& ByteData::writeBool(bool value) {
+	return writeByte(value ? 1 : 0);
+}
+
+ByteData& ByteData::writeInt(int value) {
+	int32_t number = value;
+	return write(&number, sizeof(number));
+}
+
+ByteData& ByteData::writeFloat(float value) {
+	return write(&value, sizeof(value));
+}
+
+ByteData& ByteData::writeDouble(double value) {
+	return write(&value, sizeof(value));
+}
+
+ByteData& ByteData::writeString(const std::string& value) {
+	writeInt(static_cast<int>(value.size()));
+	return write(value.data(), value.size());
+}
+
+bool ByteData::read(void* data, size_t size) {
+	if (m_position > m_size || size > m_size - m_position) {
+		m_position = m_size;
+		return false;
+	}
+	memcpy(data, getPointer() + m_position, size);
+	m_position += size;
+	return true;
+}
+
+int ByteData::readByte() {
+	uint8_t byte = 0;
+	read(&byte, sizeof(byte));
+	return byte;
+}
+
+bool ByteData::readBool() {
+	return readByte() != 0;
+}
+
+int ByteData::readInt() {
+	int32_t number = 0;
+	read(&number, sizeof(number));
+	return number;
+}
+
+float ByteData::readFloat() {
+	float value = 0.0f;
+	read(&value, sizeof(value));
+	return value;
+}
+
+double ByteData::readDouble() {
+	double value = 0.0;
+	read(&value, sizeof(value));
+	return value;
+}
+
+std::string ByteData::readString() {
+	int length = readInt();
+	if (length <= 0 || static_cast<size_t>(length) > m_size - m_position) {
+		return std::string();
+	}
+	std::string value(reinterpret_cast<const char*>(getPointer() + m_position), length);
+	m_position += length;
+	return value;
+}
+
+uint64_t ByteData::getLittleEndian(int offset, int size) {
+	if (offset < 0 || static_cast<size_t>(offset) + size > m_size) {
+		return 0;
+	}
+	const uint8_t* data = getPointer() + offset;
+	uint64_t value = 0;
+	for (int i = size - 1; i >= 0; i--) {
+		value = (value << 8) | data[i];
+	}
+	return value;
+}
+
+void ByteData::setLittleEndian(int offset, int size, uint64_t value) {
+	if (offset < 0 || static_cast<size_t>(offset) + size > m_size) {
+		return;
+	}
+	uint8_t* data = getWritePointer();
+	if (data == NULL) {
+		return;
+	}
+	data += offset;
+	for (int i = 0; i < size; i++) {
+		data[i] = static_cast<uint8_t>(value >> (i * 8));
+	}
+}
+
+int ByteData::getInt8(int offset) {
+	return static_cast<int8_t>(getLittleEndian(offset, 1));
+}
+
+int ByteData::getUint8(int offset) {
+	return static_cast<uint8_t>(getLittleEndian(offset, 1));
+}
+
+int ByteData::getInt16(int offset) {
+	return static_cast<int16_t>(getLittleEndian(offset, 2));
+}
+
+int ByteData::getUint16(int offset) {
+	return static_cast<uint16_t>(getLittleEndian(offset, 2));
+}
+
+int ByteData::getInt32(int offset) {
+	return static_cast<int32_t>(getLittleEndian(offset, 4));
+}
+
+double ByteData::getUint32(int offset) {
+	return static_cast<uint32_t>(getLittleEndian(offset, 4));
+}
+
+float ByteData::getFloat32(int offset) {
+	uint32_t bits = static_cast<uint32_t>(getLittleEndian(offset, 4));
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+double ByteData::getFloat64(int offset) {
+	uint64_t bits = getLittleEndian(offset, 8);
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+ByteData& ByteData::setInt8(int offset, int value) {
+	setLittleEndian(offset, 1, static_cast<uint8_t>(value));
+	return *this;
+}
+
+ByteData& ByteData::setUint8(int offset, int value) {
+	setLittleEndian(offset, 1, static_cast<uint8_t>(value));
+	return *this;
+}
+
+ByteData& ByteData::setInt16(int offset, int value) {
+	setLittleEndian(offset, 2, static_cast<uint16_t>(value));
+	return *this;
+}
+
+ByteData& ByteData::setUint16(int offset, int value) {
+	setLittleEndian(offset, 2, static_cast<uint16_t>(value));
+	return *this;
+}
+
+ByteData& ByteData::setInt32(int offset, int value) {
+	setLittleEndian(offset, 4, static_cast<uint32_t>(value));
+	return *this;
+}
+
+ByteData& ByteData::setUint32(int offset, double value) {
+	setLittleEndian(offset, 4, static_cast<uint32_t>(static_cast<int64_t>(value)));
+	return *this;
+}
+
+ByteData& ByteData::setFloat32(int offset, float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	setLittleEndian(offset, 4, bits);
+	return *this;
+}
+
+ByteData& ByteData::setFloat64(int offset, double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	setLittleEndian(offset, 8, bits);
+	return *this;
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,198 @@
+#ifndef SRC_LOVE_TYPES_DATA_BYTEDATA_H_
+#define SRC_LOVE_TYPES_DATA_BYTEDATA_H_
+
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * A resizable buffer of raw bytes, with a cursor for writing and reading values in sequence.
+ *
+ * The bytes are shared between copies of the ByteData and the views made with getView(), so passing a ByteData around doesn't copy its bytes. The cursor methods store values in the byte order of the host, and strings with their length first. The typed get and set methods take an offset, and use little-endian byte order.
+ *
+ * @code
+ * def serialize(data) {
+ *   data.writeInt(score)
+ *   data.writeFloat(player.x)
+ *   data.writeString(player.name)
+ * }
+ *
+ * def unserialize(data) {
+ *   score = data.readInt()
+ *   player.x = data.readFloat()
+ *   player.name = data.readString()
+ *   return true
+ * }
+ * @endcode
+ *
+ * @see love.data.newByteData
+ */
+class ByteData {
+	public:
+	ByteData();
+
+	/**
+	 * Creates a new ByteData, with room reserved for the given number of bytes.
+	 */
+	ByteData(int capacity);
+
+	/**
+	 * Creates a new ByteData holding a copy of the given string.
+	 */
+	ByteData(const std::string& contents);
+
+	/**
+	 * Points the ByteData at the given memory for reading, without copying it.
+	 *
+	 * The memory must outlive any reads, including those of copies and views of the ByteData. Writing copies the memory into the ByteData's own buffer first, but views of wrapped memory are read-only.
+	 */
+	void wrap(const void* data, size_t size);
+
+	/**
+	 * Empties the ByteData and moves the cursor to the start, while keeping the reserved memory.
+	 */
+	ByteData& clear();
+
+	/**
+	 * Sets the number of bytes in the ByteData. New bytes are set to 0.
+	 *
+	 * @return False if the ByteData is a view, which can't change its size.
+	 */
+	bool resize(int size);
+
+	/**
+	 * Gets the number of bytes in the ByteData.
+	 */
+	int getSize();
+
+	/**
+	 * Gets the contents of the ByteData as a string.
+	 */
+	std::string getString();
+
+	/**
+	 * Gets a pointer to the bytes of the ByteData.
+	 */
+	const uint8_t* getPointer();
+
+	/**
+	 * Gets a view of a range of the ByteData, which shares its bytes rather than copying them.
+	 *
+	 * Writing to the view changes the original ByteData. The view can't grow past its size, and views of wrapped memory can't be written to at all.
+	 *
+	 * @param offset The first byte of the view.
+	 * @param size The number of bytes in the view, or -1 for the rest of the ByteData.
+	 */
+	ByteData getView(int offset, int size);
+	ByteData getView(int offset);
+
+	/**
+	 * Makes a copy of the ByteData that doesn't share its bytes.
+	 */
+	ByteData clone();
+
+	/**
+	 * Gets the position of the cursor.
+	 */
+	int tell();
+
+	/**
+	 * Moves the cursor to the given position.
+	 *
+	 * @return True if the position is within the ByteData.
+	 */
+	bool seek(int position);
+
+	/**
+	 * Whether or not the cursor has reached the end of the ByteData.
+	 */
+	bool isEOF();
+
+	ByteData& writeByte(int value);
+	ByteData& writeBool(bool value);
+	ByteData& writeInt(int value);
+	ByteData& writeFloat(float value);
+	ByteData& writeDouble(double value);
+	ByteData& writeString(const std::string& value);
+
+	/**
+	 * Writes the given bytes at the cursor.
+	 */
+	ByteData& write(const void* data, size_t size);
+
+	/**
+	 * Reads values at the cursor. Reading past the end returns 0, false or an empty string.
+	 */
+	int readByte();
+	bool readBool();
+	int readInt();
+	float readFloat();
+	double readDouble();
+	std::string readString();
+
+	/**
+	 * Reads the given number of bytes at the cursor.
+	 *
+	 * @return True if there were enough bytes left.
+	 */
+	bool read(void* data, size_t size);
+
+	/**
+	 * Gets a little-endian value at the given offset. Offsets outside the ByteData return 0.
+	 */
+	int getInt8(int offset);
+	int getUint8(int offset);
+	int getInt16(int offset);
+	int getUint16(int offset);
+	int getInt32(int offset);
+	double getUint32(int offset);
+	float getFloat32(int offset);
+	double getFloat64(int offset);
+
+	/**
+	 * Sets a little-endian value at the given offset. Offsets outside the ByteData are ignored.
+	 *
+	 * @return The ByteData, to allow for method chaining.
+	 */
+	ByteData& setInt8(int offset, int value);
+	ByteData& setUint8(int offset, int value);
+	ByteData& setInt16(int offset, int value);
+	ByteData& setUint16(int offset, int value);
+	ByteData& setInt32(int offset, int value);
+	ByteData& setUint32(int offset, double value);
+	ByteData& setFloat32(int offset, float value);
+	ByteData& setFloat64(int offset, double value);
+
+	/**
+	 * Gets the given number of bytes at the offset as a little-endian unsigned integer.
+	 */
+	uint64_t getLittleEndian(int offset, int size);
+	void setLittleEndian(int offset, int size, uint64_t value);
+
+	private:
+	/**
+	 * Makes sure that the bytes are in memory owned by the ByteData, so that they can be written to.
+	 *
+	 * @return False for views of wrapped memory, which can't be written to.
+	 */
+	bool own();
+	uint8_t* getWritePointer();
+
+	std::shared_ptr<std::vector<uint8_t> > m_buffer;
+	const uint8_t* m_data = NULL;
+	size_t m_offset = 0;
+	size_t m_size = 0;
+	size_t m_position = 0;
+	bool m_view = false;
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_BYTEDATA_H_
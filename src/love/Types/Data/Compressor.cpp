@@ -0,0 +1,133 @@
+#include "Compressor.h"
+#include <string.h>
+#include <string>
+#include <vector>
+#include "compat/zlib.h"
+#include "pntr_app.h"
+
+namespace love {
+namespace Types {
+namespace Data {
+
+Compressor::Compressor(const std::string& format, int level, bool decompress) : m_decompress(decompress), m_buffer(65536) {
+	memset(&m_stream, 0, sizeof(m_stream));
+	int windowBits = getWindowBits(format);
+	if (windowBits == 0) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Unknown stream compression format %s.", format.c_str());
+		return;
+	}
+
+	if (decompress) {
+		m_valid = inflateInit2(&m_stream, windowBits) == Z_OK;
+	} else {
+		if (level < 0 || level > 9) {
+			level = Z_DEFAULT_COMPRESSION;
+		}
+		m_valid = deflateInit2(&m_stream, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+	}
+	if (!m_valid) {
+		pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Failed to initialize the compression stream.");
+	}
+}
+
+Compressor::~Compressor() {
+	end();
+}
+
+int Compressor::getWindowBits(const std::string& format) {
+	if (format == "zlib") {
+		return MAX_WBITS;
+	}
+	if (format == "gzip") {
+		return MAX_WBITS + 16;
+	}
+	if (format == "deflate") {
+		return -MAX_WBITS;
+	}
+	return 0;
+}
+
+void Compressor::end() {
+	if (!m_valid) {
+		return;
+	}
+	if (m_decompress) {
+		inflateEnd(&m_stream);
+	} else {
+		deflateEnd(&m_stream);
+	}
+	m_valid = false;
+	std::vector<char>().swap(m_buffer);
+}
+
+bool Compressor::isValid() {
+	return m_valid;
+}
+
+bool Compressor::isFinished() {
+	return m_finished;
+}
+
+int Compressor::getTotalIn() {
+	return static_cast<int>(m_stream.total_in);
+}
+
+int Compressor::getTotalOut() {
+	return static_cast<int>(m_stream.total_out);
+}
+
+bool Compressor::run(const std::string& input, int flush, std::string* output) {
+	m_stream.next_in = (Bytef*)input.data();
+	m_stream.avail_in = input.size();
+
+	// Keep going while the stream fills the whole buffer, as there may be more output waiting.
+	int ret;
+	do {
+		m_stream.next_out = reinterpret_cast<Bytef*>(m_buffer.data());
+		m_stream.avail_out = m_buffer.size();
+		ret = m_decompress ? inflate(&m_stream, flush) : deflate(&m_stream, flush);
+		output->append(m_buffer.data(), m_buffer.size() - m_stream.avail_out);
+	} while (ret == Z_OK && (m_stream.avail_out == 0 || m_stream.avail_in > 0));
+
+	if (ret == Z_STREAM_END) {
+		m_finished = true;
+		return true;
+	}
+	if (ret != Z_OK && ret != Z_BUF_ERROR) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Compression stream failed: (%d) %s", ret, m_stream.msg != NULL ? m_stream.msg : "");
+		return false;
+	}
+	return true;
+}
+
+std::string Compressor::push(const std::string& chunk) {
+	std::string output;
+	if (!m_valid || m_finished) {
+		return output;
+	}
+	if (!run(chunk, Z_NO_FLUSH, &output)) {
+		end();
+	}
+	return output;
+}
+
+std::string Compressor::finish() {
+	std::string output;
+	if (m_valid && !m_finished) {
+		if (m_decompress) {
+			// Decompressing ends when the input reaches the end of the stream.
+			run(std::string(), Z_SYNC_FLUSH, &output);
+			if (!m_finished) {
+				pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Compressed stream ended early.");
+			}
+		} else {
+			run(std::string(), Z_FINISH, &output);
+		}
+	}
+	end();
+	return output;
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,101 @@
+#ifndef SRC_LOVE_TYPES_DATA_COMPRESSOR_H_
+#define SRC_LOVE_TYPES_DATA_COMPRESSOR_H_
+
+#include <string>
+#include <vector>
+
+#include "compat/zlib.h"
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * Compresses or decompresses a stream of data in chunks, so that the whole input and output don't need to be in memory at once.
+ *
+ * Supports the "zlib", "gzip" and "deflate" formats.
+ *
+ * @code
+ * var compressor = love.data.newCompressor("gzip")
+ * var compressed = compressor.push("Hello ")
+ * compressed += compressor.push("World!")
+ * compressed += compressor.finish()
+ *
+ * var decompressor = love.data.newDecompressor("gzip")
+ * var message = decompressor.push(compressed)
+ * message += decompressor.finish()
+ * @endcode
+ *
+ * @see love.data.newCompressor
+ * @see love.data.newDecompressor
+ */
+class Compressor {
+	public:
+	/**
+	 * Creates a new compressor or decompressor.
+	 *
+	 * @param format The format of the compressed data: "zlib", "gzip" or "deflate".
+	 * @param level The level of compression, between 0 and 9, or -1 for the default level. Not used when decompressing.
+	 * @param decompress True to decompress, false to compress.
+	 */
+	Compressor(const std::string& format, int level, bool decompress);
+	~Compressor();
+
+	/**
+	 * Whether or not the stream was set up correctly.
+	 */
+	bool isValid();
+
+	/**
+	 * Whether or not the stream has reached its end.
+	 */
+	bool isFinished();
+
+	/**
+	 * Passes the next chunk of input through the stream.
+	 *
+	 * @return The output that is ready so far, which may be empty.
+	 */
+	std::string push(const std::string& chunk);
+
+	/**
+	 * Ends the stream, and frees its memory.
+	 *
+	 * @return The rest of the output.
+	 */
+	std::string finish();
+
+	/**
+	 * Gets the total number of bytes that went into the stream.
+	 */
+	int getTotalIn();
+
+	/**
+	 * Gets the total number of bytes that came out of the stream.
+	 */
+	int getTotalOut();
+
+	/**
+	 * Gets the zlib window bits for the given format, or 0 if it isn't one of the zlib formats.
+	 */
+	static int getWindowBits(const std::string& format);
+
+	private:
+	/**
+	 * Runs the stream over the given input, appending what comes out to the output.
+	 */
+	bool run(const std::string& input, int flush, std::string* output);
+	void end();
+
+	z_stream m_stream;
+	bool m_decompress;
+	bool m_valid = false;
+	bool m_finished = false;
+	std::vector<char> m_buffer;
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_COMPRESSOR_H_
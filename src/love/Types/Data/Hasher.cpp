@@ -0,0 +1,218 @@
+#include "Hasher.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "compat/zlib.h"
+
+namespace love {
+namespace Types {
+namespace Data {
+
+namespace {
+
+const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+/**
+ * Reads little-endian values, so that the digests are the same on every platform. Compilers turn these into single loads.
+ */
+inline uint64_t read64(const uint8_t* p) {
+	return static_cast<uint64_t>(p[0]) | (static_cast<uint64_t>(p[1]) << 8) |
+		(static_cast<uint64_t>(p[2]) << 16) | (static_cast<uint64_t>(p[3]) << 24) |
+		(static_cast<uint64_t>(p[4]) << 32) | (static_cast<uint64_t>(p[5]) << 40) |
+		(static_cast<uint64_t>(p[6]) << 48) | (static_cast<uint64_t>(p[7]) << 56);
+}
+
+inline uint32_t read32(const uint8_t* p) {
+	return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+		(static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline uint64_t rotl64(uint64_t value, int bits) {
+	return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t round64(uint64_t lane, uint64_t input) {
+	lane += input * PRIME64_2;
+	lane = rotl64(lane, 31);
+	return lane * PRIME64_1;
+}
+
+inline uint64_t mergeRound64(uint64_t hash, uint64_t lane) {
+	hash ^= round64(0, lane);
+	return hash * PRIME64_1 + PRIME64_4;
+}
+
+}  // namespace
+
+Hasher::Hasher(const std::string& hashFunction) {
+	if (hashFunction == "md5") {
+		m_function = HASH_MD5;
+		MD5_Init(&m_md5);
+	} else if (hashFunction == "sha1") {
+		m_function = HASH_SHA1;
+	} else if (hashFunction == "xxh64") {
+		m_function = HASH_XXH64;
+		m_lanes[0] = PRIME64_1 + PRIME64_2;
+		m_lanes[1] = PRIME64_2;
+		m_lanes[2] = 0;
+		m_lanes[3] = 0 - PRIME64_1;
+	} else if (hashFunction == "crc32") {
+		m_function = HASH_CRC32;
+		m_crc32 = crc32(0L, Z_NULL, 0);
+	}
+}
+
+bool Hasher::isValid() {
+	return m_function != HASH_UNKNOWN;
+}
+
+Hasher& Hasher::update(const void* data, size_t size) {
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	switch (m_function) {
+		case HASH_MD5:
+			MD5_Update(&m_md5, bytes, size);
+			break;
+		case HASH_SHA1:
+			m_sha1.processBytes(bytes, size);
+			break;
+		case HASH_XXH64:
+			updateXXH64(bytes, size);
+			break;
+		case HASH_CRC32:
+			// zlib takes the length as an unsigned int, so feed it in pieces that fit.
+			while (size > 0) {
+				uInt chunk = size > 0x40000000 ? 0x40000000 : static_cast<uInt>(size);
+				m_crc32 = crc32(m_crc32, bytes, chunk);
+				bytes += chunk;
+				size -= chunk;
+			}
+			break;
+		case HASH_UNKNOWN:
+			break;
+	}
+	return *this;
+}
+
+std::string Hasher::finish() {
+	char output[48];
+	switch (m_function) {
+		case HASH_MD5: {
+			unsigned char digest[16];
+			MD5_Final(digest, &m_md5);
+			for (int i = 0; i < 16; ++i) {
+				snprintf(&output[i * 2], 3, "%02x", (unsigned int)digest[i]); /* NOLINT(runtime/printf).  */
+			}
+			break;
+		}
+		case HASH_SHA1: {
+			uint32_t digest[5];
+			m_sha1.getDigest(digest);
+			snprintf(output, sizeof(output), "%08x%08x%08x%08x%08x",
+				(unsigned int) digest[0], (unsigned int) digest[1],
+				(unsigned int) digest[2], (unsigned int) digest[3],
+				(unsigned int) digest[4]);
+			break;
+		}
+		case HASH_XXH64: {
+			uint64_t digest = finishXXH64();
+			snprintf(output, sizeof(output), "%08x%08x", (unsigned int)(digest >> 32), (unsigned int)(digest & 0xFFFFFFFF));
+			break;
+		}
+		case HASH_CRC32:
+			snprintf(output, sizeof(output), "%08x", (unsigned int)m_crc32);
+			break;
+		case HASH_UNKNOWN:
+			return "";
+	}
+	return std::string(output);
+}
+
+void Hasher::updateXXH64(const uint8_t* data, size_t size) {
+	m_length += size;
+
+	// Top up the stripe left over from the last update.
+	if (m_stripeSize > 0) {
+		size_t fill = sizeof(m_stripe) - m_stripeSize;
+		if (size < fill) {
+			memcpy(m_stripe + m_stripeSize, data, size);
+			m_stripeSize += size;
+			return;
+		}
+		memcpy(m_stripe + m_stripeSize, data, fill);
+		for (int i = 0; i < 4; i++) {
+			m_lanes[i] = round64(m_lanes[i], read64(m_stripe + i * 8));
+		}
+		data += fill;
+		size -= fill;
+		m_stripeSize = 0;
+	}
+
+	// Consume whole 32-byte stripes straight from the input.
+	uint64_t v1 = m_lanes[0], v2 = m_lanes[1], v3 = m_lanes[2], v4 = m_lanes[3];
+	while (size >= sizeof(m_stripe)) {
+		v1 = round64(v1, read64(data));
+		v2 = round64(v2, read64(data + 8));
+		v3 = round64(v3, read64(data + 16));
+		v4 = round64(v4, read64(data + 24));
+		data += sizeof(m_stripe);
+		size -= sizeof(m_stripe);
+	}
+	m_lanes[0] = v1;
+	m_lanes[1] = v2;
+	m_lanes[2] = v3;
+	m_lanes[3] = v4;
+
+	memcpy(m_stripe, data, size);
+	m_stripeSize = size;
+}
+
+uint64_t Hasher::finishXXH64() {
+	uint64_t hash;
+	if (m_length >= sizeof(m_stripe)) {
+		hash = rotl64(m_lanes[0], 1) + rotl64(m_lanes[1], 7) + rotl64(m_lanes[2], 12) + rotl64(m_lanes[3], 18);
+		for (int i = 0; i < 4; i++) {
+			hash = mergeRound64(hash, m_lanes[i]);
+		}
+	} else {
+		hash = PRIME64_5;
+	}
+	hash += m_length;
+
+	const uint8_t* p = m_stripe;
+	size_t remaining = m_stripeSize;
+	while (remaining >= 8) {
+		hash ^= round64(0, read64(p));
+		hash = rotl64(hash, 27) * PRIME64_1 + PRIME64_4;
+		p += 8;
+		remaining -= 8;
+	}
+	if (remaining >= 4) {
+		hash ^= static_cast<uint64_t>(read32(p)) * PRIME64_1;
+		hash = rotl64(hash, 23) * PRIME64_2 + PRIME64_3;
+		p += 4;
+		remaining -= 4;
+	}
+	while (remaining > 0) {
+		hash ^= (*p) * PRIME64_5;
+		hash = rotl64(hash, 11) * PRIME64_1;
+		p++;
+		remaining--;
+	}
+
+	// Mix the bits, so that every input bit affects every output bit.
+	hash ^= hash >> 33;
+	hash *= PRIME64_2;
+	hash ^= hash >> 29;
+	hash *= PRIME64_3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
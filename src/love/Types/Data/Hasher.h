@@ -0,0 +1,76 @@
+#ifndef SRC_LOVE_TYPES_DATA_HASHER_H_
+#define SRC_LOVE_TYPES_DATA_HASHER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include "utils/md5.h"
+#include "TinySHA1.hpp"
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * Computes a message digest from data given in one or more chunks.
+ *
+ * Supports md5 and sha1, along with the non-cryptographic xxh64 and crc32, which are many times faster, and meant for cache keys and integrity checks.
+ *
+ * @see love.data.hash
+ * @see love.filesystem.hash
+ */
+class Hasher {
+	public:
+	/**
+	 * Starts a new hash.
+	 *
+	 * @param hashFunction The hash algorithm to use: "md5", "sha1", "xxh64" or "crc32".
+	 */
+	Hasher(const std::string& hashFunction);
+
+	/**
+	 * Whether or not the hash algorithm is known.
+	 */
+	bool isValid();
+
+	/**
+	 * Adds the given bytes to the hash.
+	 */
+	Hasher& update(const void* data, size_t size);
+
+	/**
+	 * Gets the digest of all the bytes given so far, as a lowercase hexadecimal string.
+	 *
+	 * @return The digest, or an empty string if the hash algorithm is unknown.
+	 */
+	std::string finish();
+
+	private:
+	enum HashFunction {
+		HASH_UNKNOWN,
+		HASH_MD5,
+		HASH_SHA1,
+		HASH_XXH64,
+		HASH_CRC32
+	};
+
+	void updateXXH64(const uint8_t* data, size_t size);
+	uint64_t finishXXH64();
+
+	HashFunction m_function = HASH_UNKNOWN;
+	MD5_CTX m_md5;
+	sha1::SHA1 m_sha1;
+	uint32_t m_crc32 = 0;
+
+	// The state of xxh64: the four lanes, the total length, and the bytes that don't fill a stripe yet.
+	uint64_t m_lanes[4];
+	uint64_t m_length = 0;
+	uint8_t m_stripe[32];
+	size_t m_stripeSize = 0;
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_HASHER_H_
@@ -0,0 +1,91 @@
+#include "Hex.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HEX_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace love {
+namespace Types {
+namespace Data {
+
+namespace {
+
+const char DIGITS[] = "0123456789abcdef";
+
+/**
+ * Maps each character to its value, or 0xFF for characters that aren't hexadecimal digits.
+ */
+struct DecodeTable {
+	uint8_t values[256];
+
+	DecodeTable() {
+		memset(values, 0xFF, sizeof(values));
+		for (int i = 0; i < 10; i++) {
+			values['0' + i] = static_cast<uint8_t>(i);
+		}
+		for (int i = 0; i < 6; i++) {
+			values['a' + i] = static_cast<uint8_t>(10 + i);
+			values['A' + i] = static_cast<uint8_t>(10 + i);
+		}
+	}
+};
+
+const DecodeTable DECODE_TABLE;
+
+#ifdef HEX_SSE2
+/**
+ * Turns each nibble into its digit, adding the distance from '9' to 'a' to the nibbles above 9.
+ */
+inline __m128i nibblesToDigits(__m128i nibbles) {
+	__m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+	return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+#endif
+
+}  // namespace
+
+void Hex::encode(const uint8_t* source, size_t size, char* destination) {
+	size_t done = 0;
+	#ifdef HEX_SSE2
+	const __m128i mask = _mm_set1_epi8(0x0F);
+	for (; size - done >= 16; done += 16) {
+		__m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + done));
+		__m128i high = nibblesToDigits(_mm_and_si128(_mm_srli_epi16(input, 4), mask));
+		__m128i low = nibblesToDigits(_mm_and_si128(input, mask));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 16), _mm_unpackhi_epi8(high, low));
+		destination += 32;
+	}
+	#endif
+
+	for (; done < size; done++) {
+		destination[0] = DIGITS[source[done] >> 4];
+		destination[1] = DIGITS[source[done] & 0x0F];
+		destination += 2;
+	}
+}
+
+bool Hex::decode(const char* source, size_t size, uint8_t* destination) {
+	if (size % 2 != 0) {
+		return false;
+	}
+
+	const uint8_t* input = reinterpret_cast<const uint8_t*>(source);
+	const uint8_t* values = DECODE_TABLE.values;
+	for (size_t i = 0; i < size / 2; i++) {
+		uint8_t high = values[input[i * 2]];
+		uint8_t low = values[input[i * 2 + 1]];
+		if ((high | low) & 0x80) {
+			return false;
+		}
+		destination[i] = static_cast<uint8_t>((high << 4) | low);
+	}
+	return true;
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,45 @@
+#ifndef SRC_LOVE_TYPES_DATA_HEX_H_
+#define SRC_LOVE_TYPES_DATA_HEX_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * Encodes bytes as lowercase hexadecimal, and decodes hexadecimal of either case, writing straight into a buffer of the right size.
+ *
+ * With SSE2, encoding handles 16 bytes at a time.
+ *
+ * @see love.data.encode
+ */
+class Hex {
+	public:
+	/**
+	 * Encodes the given bytes.
+	 *
+	 * @param source The bytes to encode.
+	 * @param size The number of bytes to encode.
+	 * @param destination Receives the encoded characters. Must hold twice as many bytes as the source.
+	 */
+	static void encode(const uint8_t* source, size_t size, char* destination);
+
+	/**
+	 * Decodes the given characters.
+	 *
+	 * @param source The characters to decode.
+	 * @param size The number of characters, which must be even.
+	 * @param destination Receives the decoded bytes. Must hold half as many bytes as there are characters.
+	 *
+	 * @return False if the characters aren't valid hexadecimal.
+	 */
+	static bool decode(const char* source, size_t size, uint8_t* destination);
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_HEX_H_
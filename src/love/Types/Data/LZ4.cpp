@@ -0,0 +1,215 @@
+#include "LZ4.h"
+#include <stdint.h>
+#include <string.h>
+
+namespace love {
+namespace Types {
+namespace Data {
+
+namespace {
+
+const size_t MIN_MATCH = 4;
+
+/**
+ * The last bytes of a block are always literals, and the last match must start before MATCH_LIMIT bytes from the end.
+ */
+const size_t LAST_LITERALS = 5;
+const size_t MATCH_LIMIT = 12;
+
+const size_t MAX_OFFSET = 65535;
+const int HASH_LOG = 12;
+
+inline uint32_t read32(const uint8_t* p) {
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline uint32_t hash(uint32_t sequence) {
+	return (sequence * 2654435761U) >> (32 - HASH_LOG);
+}
+
+/**
+ * Writes the remainder of a literal or match length, past the 15 that fit in the token.
+ */
+inline uint8_t* writeLength(uint8_t* output, size_t length) {
+	while (length >= 255) {
+		*output++ = 255;
+		length -= 255;
+	}
+	*output++ = static_cast<uint8_t>(length);
+	return output;
+}
+
+inline bool readLength(const uint8_t** input, const uint8_t* end, size_t* length) {
+	uint8_t byte;
+	do {
+		if (*input >= end) {
+			return false;
+		}
+		byte = *(*input)++;
+		*length += byte;
+	} while (byte == 255);
+	return true;
+}
+
+}  // namespace
+
+size_t LZ4::compressBound(size_t size) {
+	return size + size / 255 + 16;
+}
+
+size_t LZ4::decompressBound(size_t size) {
+	// Each byte of a block can at most add 255 bytes to a match length.
+	return size * 255;
+}
+
+size_t LZ4::compress(const uint8_t* source, size_t sourceSize, uint8_t* destination) {
+	const uint8_t* input = source;
+	const uint8_t* anchor = source;
+	const uint8_t* end = source + sourceSize;
+	uint8_t* output = destination;
+
+	if (sourceSize > MATCH_LIMIT) {
+		const uint8_t* matchStartLimit = end - MATCH_LIMIT;
+		const uint8_t* matchEndLimit = end - LAST_LITERALS;
+		uint32_t table[1 << HASH_LOG];
+		memset(table, 0, sizeof(table));
+
+		while (input < matchStartLimit) {
+			uint32_t sequence = read32(input);
+			uint32_t& entry = table[hash(sequence)];
+			const uint8_t* match = source + entry;
+			entry = static_cast<uint32_t>(input - source);
+
+			if (match >= input || static_cast<size_t>(input - match) > MAX_OFFSET || read32(match) != sequence) {
+				// Skip ahead faster through data that doesn't compress.
+				input += 1 + ((input - anchor) >> 6);
+				continue;
+			}
+
+			// Extend the match backwards, then forwards.
+			while (input > anchor && match > source && input[-1] == match[-1]) {
+				input--;
+				match--;
+			}
+			const uint8_t* matchEnd = input + MIN_MATCH;
+			const uint8_t* reference = match + MIN_MATCH;
+			while (matchEnd < matchEndLimit && *matchEnd == *reference) {
+				matchEnd++;
+				reference++;
+			}
+
+			// Write the sequence: the token, the literals, the offset, and the match length.
+			size_t literalLength = input - anchor;
+			size_t matchLength = matchEnd - input - MIN_MATCH;
+			uint8_t* token = output++;
+			*token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+			if (literalLength >= 15) {
+				output = writeLength(output, literalLength - 15);
+			}
+			memcpy(output, anchor, literalLength);
+			output += literalLength;
+			size_t offset = input - match;
+			*output++ = static_cast<uint8_t>(offset);
+			*output++ = static_cast<uint8_t>(offset >> 8);
+			*token |= static_cast<uint8_t>(matchLength >= 15 ? 15 : matchLength);
+			if (matchLength >= 15) {
+				output = writeLength(output, matchLength - 15);
+			}
+
+			input = matchEnd;
+			anchor = input;
+			if (input - 2 > source) {
+				table[hash(read32(input - 2))] = static_cast<uint32_t>(input - 2 - source);
+			}
+		}
+	}
+
+	// The rest of the input is written as literals.
+	size_t literalLength = end - anchor;
+	*output++ = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+	if (literalLength >= 15) {
+		output = writeLength(output, literalLength - 15);
+	}
+	memcpy(output, anchor, literalLength);
+	output += literalLength;
+
+	return output - destination;
+}
+
+bool LZ4::decompress(const uint8_t* source, size_t sourceSize, uint8_t* destination, size_t destinationSize) {
+	const uint8_t* input = source;
+	const uint8_t* inputEnd = source + sourceSize;
+	uint8_t* output = destination;
+	uint8_t* outputEnd = destination + destinationSize;
+
+	while (input < inputEnd) {
+		uint8_t token = *input++;
+
+		// Copy the literals.
+		size_t literalLength = token >> 4;
+		if (literalLength == 15 && !readLength(&input, inputEnd, &literalLength)) {
+			return false;
+		}
+		if (literalLength > static_cast<size_t>(inputEnd - input) || literalLength > static_cast<size_t>(outputEnd - output)) {
+			return false;
+		}
+		if (literalLength <= 16 && inputEnd - input >= 16 && outputEnd - output >= 16) {
+			// Copy short literals with a single fixed-size copy, as there is room for it.
+			memcpy(output, input, 16);
+		} else {
+			memcpy(output, input, literalLength);
+		}
+		output += literalLength;
+		input += literalLength;
+
+		// The last sequence only has literals.
+		if (input >= inputEnd) {
+			break;
+		}
+
+		// Copy the match.
+		if (inputEnd - input < 2) {
+			return false;
+		}
+		size_t offset = input[0] | (input[1] << 8);
+		input += 2;
+		if (offset == 0 || offset > static_cast<size_t>(output - destination)) {
+			return false;
+		}
+		size_t matchLength = token & 15;
+		if (matchLength == 15 && !readLength(&input, inputEnd, &matchLength)) {
+			return false;
+		}
+		matchLength += MIN_MATCH;
+		if (matchLength > static_cast<size_t>(outputEnd - output)) {
+			return false;
+		}
+		const uint8_t* match = output - offset;
+		if (offset >= 8 && static_cast<size_t>(outputEnd - output) >= matchLength + 8) {
+			// Copy in fixed-size chunks, which may write past the match into space that is overwritten later.
+			uint8_t* matchEnd = output + matchLength;
+			while (output < matchEnd) {
+				memcpy(output, match, 8);
+				output += 8;
+				match += 8;
+			}
+			output = matchEnd;
+		} else if (offset >= matchLength) {
+			memcpy(output, match, matchLength);
+			output += matchLength;
+		} else {
+			// The match overlaps the output, which repeats the last bytes.
+			for (size_t i = 0; i < matchLength; i++) {
+				*output++ = *match++;
+			}
+		}
+	}
+
+	return output == outputEnd;
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
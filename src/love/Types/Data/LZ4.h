@@ -0,0 +1,58 @@
+#ifndef SRC_LOVE_TYPES_DATA_LZ4_H_
+#define SRC_LOVE_TYPES_DATA_LZ4_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * A compressor for the LZ4 block format, which trades compression ratio for speed.
+ *
+ * The blocks are compatible with LZ4_decompress_safe() from the reference implementation. They don't hold their uncompressed size, so it has to be stored alongside them.
+ *
+ * @see love.data.compress
+ */
+class LZ4 {
+	public:
+	/**
+	 * Gets the largest size that compressing the given number of bytes can produce.
+	 */
+	static size_t compressBound(size_t size);
+
+	/**
+	 * Gets the largest size that a block of the given size can decompress to, so that sizes read from untrusted data can be checked before allocating.
+	 */
+	static size_t decompressBound(size_t size);
+
+	/**
+	 * Compresses the given bytes into a single block.
+	 *
+	 * @param source The bytes to compress.
+	 * @param sourceSize The number of bytes to compress.
+	 * @param destination Receives the block. Must hold at least compressBound(sourceSize) bytes.
+	 *
+	 * @return The size of the block.
+	 */
+	static size_t compress(const uint8_t* source, size_t sourceSize, uint8_t* destination);
+
+	/**
+	 * Decompresses a block.
+	 *
+	 * @param source The block to decompress.
+	 * @param sourceSize The size of the block.
+	 * @param destination Receives the decompressed bytes.
+	 * @param destinationSize The exact size of the decompressed bytes.
+	 *
+	 * @return True if the block was valid, and decompressed to exactly destinationSize bytes.
+	 */
+	static bool decompress(const uint8_t* source, size_t sourceSize, uint8_t* destination, size_t destinationSize);
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_LZ4_H_
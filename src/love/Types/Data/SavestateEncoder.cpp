@@ -0,0 +1,383 @@
+#include "SavestateEncoder.h"
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <iterator>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include "LZ4.h"
+#include "pntr_app.h"
+
+namespace love {
+namespace Types {
+namespace Data {
+
+namespace {
+
+/**
+ * The largest number of states between each keyframe, which bounds the deltas applied to rebuild a state.
+ */
+const int KEYFRAME_INTERVAL = 60;
+
+/**
+ * The number of full states that the kept keyframes and deltas may add up to, which bounds how far back delta states can be loaded.
+ */
+const size_t MAX_STORED_STATES = 64;
+
+const uint8_t FLAG_COMPRESSED = 1;
+
+void writeVarint(std::vector<uint8_t>* output, size_t value) {
+	while (value >= 0x80) {
+		output->push_back(static_cast<uint8_t>(value | 0x80));
+		value >>= 7;
+	}
+	output->push_back(static_cast<uint8_t>(value));
+}
+
+bool readVarint(const uint8_t* data, size_t size, size_t* position, size_t* value) {
+	*value = 0;
+	for (int shift = 0; shift < 35 && *position < size; shift += 7) {
+		uint8_t byte = data[(*position)++];
+		*value |= static_cast<size_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void writeUint32(uint8_t* output, uint32_t value) {
+	memcpy(output, &value, sizeof(value));
+}
+
+uint32_t readUint32(const uint8_t* input) {
+	uint32_t value;
+	memcpy(&value, input, sizeof(value));
+	return value;
+}
+
+}  // namespace
+
+SavestateEncoder::SavestateEncoder() {
+	// Tell this session's states apart from the ones saved by earlier sessions, whose ids may be reused.
+	m_session = static_cast<uint32_t>(time(NULL)) ^ static_cast<uint32_t>(reinterpret_cast<uintptr_t>(this));
+}
+
+void SavestateEncoder::setDelta(bool delta) {
+	m_delta = delta;
+}
+
+void SavestateEncoder::setCompress(bool compress) {
+	m_compress = compress;
+}
+
+bool SavestateEncoder::isEnabled() {
+	return m_delta || m_compress;
+}
+
+std::string SavestateEncoder::getError() {
+	return m_error;
+}
+
+void SavestateEncoder::addState(uint32_t id, uint32_t base, int depth, size_t size, const uint8_t* data, size_t dataSize) {
+	State& state = m_states[id];
+	state.base = base;
+	state.depth = depth;
+	state.size = size;
+	state.data.assign(data, data + dataSize);
+	m_storedBytes += dataSize;
+	if (depth > 0) {
+		return;
+	}
+
+	// Keep the keyframes in order, as one from earlier in the session can be loaded again.
+	std::list<uint32_t>::iterator position = m_keyframes.end();
+	while (position != m_keyframes.begin() && *std::prev(position) > id) {
+		--position;
+	}
+	m_keyframes.insert(position, id);
+
+	// Drop the oldest keyframe when there's too much, along with the states before the next one, as they can't be rebuilt without it.
+	while (m_keyframes.size() > 1 && m_storedBytes > MAX_STORED_STATES * size) {
+		m_keyframes.pop_front();
+		std::map<uint32_t, State>::iterator end = m_states.lower_bound(m_keyframes.front());
+		for (std::map<uint32_t, State>::iterator dropped = m_states.begin(); dropped != end; ++dropped) {
+			m_storedBytes -= dropped->second.data.size();
+		}
+		m_states.erase(m_states.begin(), end);
+	}
+}
+
+bool SavestateEncoder::rebuild(uint32_t id, std::vector<uint8_t>* output, size_t* deltaBytes) {
+	if (id == m_previous) {
+		*output = m_previousData;
+		*deltaBytes = m_deltaBytes;
+		return true;
+	}
+
+	// Walk back to the keyframe, and apply the deltas from there.
+	m_chain.clear();
+	std::map<uint32_t, State>::iterator state = m_states.find(id);
+	while (state != m_states.end() && state->second.depth > 0 && m_chain.size() <= static_cast<size_t>(KEYFRAME_INTERVAL)) {
+		m_chain.push_back(&state->second);
+		state = m_states.find(state->second.base);
+	}
+	if (state == m_states.end() || state->second.depth > 0) {
+		return false;
+	}
+
+	*output = state->second.data;
+	*deltaBytes = 0;
+	for (std::vector<const State*>::reverse_iterator delta = m_chain.rbegin(); delta != m_chain.rend(); ++delta) {
+		if (!readDelta((*delta)->data.data(), (*delta)->data.size(), *output, (*delta)->size, &m_rebuilt)) {
+			return false;
+		}
+		output->swap(m_rebuilt);
+		*deltaBytes += (*delta)->data.size();
+	}
+	return true;
+}
+
+void SavestateEncoder::writeDelta(const uint8_t* data, size_t size, const std::vector<uint8_t>& base, std::vector<uint8_t>* output) {
+	output->clear();
+	size_t baseSize = base.size();
+	size_t i = 0;
+	while (i < size) {
+		// Skip the bytes that match the base.
+		size_t start = i;
+		while (i < size && i < baseSize && data[i] == base[i]) {
+			i++;
+		}
+		size_t unchanged = i - start;
+
+		// Take the changed bytes, until there are at least four unchanged bytes in a row.
+		size_t changedStart = i;
+		while (i < size) {
+			size_t same = i;
+			while (same < size && same < baseSize && data[same] == base[same] && same - i < 4) {
+				same++;
+			}
+			if (same - i >= 4 || same == size) {
+				break;
+			}
+			i = same + 1;
+		}
+
+		writeVarint(output, unchanged);
+		writeVarint(output, i - changedStart);
+		for (size_t j = changedStart; j < i; j++) {
+			output->push_back(data[j] ^ (j < baseSize ? base[j] : 0));
+		}
+	}
+}
+
+bool SavestateEncoder::readDelta(const uint8_t* data, size_t size, const std::vector<uint8_t>& base, size_t stateSize, std::vector<uint8_t>* output) {
+	// Bytes past the base each take a byte of the delta, which bounds the size before allocating it.
+	size_t baseSize = base.size();
+	if (stateSize > baseSize + size) {
+		return false;
+	}
+	output->resize(stateSize);
+	size_t position = 0;
+	size_t i = 0;
+	while (i < stateSize) {
+		size_t unchanged, changed;
+		if (!readVarint(data, size, &position, &unchanged) || !readVarint(data, size, &position, &changed)) {
+			return false;
+		}
+		if (unchanged > stateSize - i || changed > stateSize - i - unchanged || changed > size - position || i + unchanged > baseSize) {
+			return false;
+		}
+		memcpy(output->data() + i, base.data() + i, unchanged);
+		i += unchanged;
+		for (size_t j = 0; j < changed; j++, i++) {
+			(*output)[i] = data[position++] ^ (i < baseSize ? base[i] : 0);
+		}
+	}
+	return position == size;
+}
+
+void SavestateEncoder::encode(const uint8_t* data, size_t size, ByteData& output) {
+	Kind kind = KIND_RAW;
+	uint32_t id = 0;
+	uint32_t base = 0;
+	const uint8_t* body = data;
+	size_t bodySize = size;
+
+	if (m_delta) {
+		id = m_nextID++;
+		std::map<uint32_t, State>::iterator previous = m_states.find(m_previous);
+		if (previous != m_states.end() && previous->second.depth + 1 < KEYFRAME_INTERVAL) {
+			// Only keep the delta while it, and the deltas before it, are smaller than a keyframe.
+			writeDelta(data, size, m_previousData, &m_body);
+			if (m_body.size() < size && m_deltaBytes + m_body.size() < size) {
+				kind = KIND_DELTA;
+				base = m_previous;
+				body = m_body.data();
+				bodySize = m_body.size();
+				addState(id, base, previous->second.depth + 1, size, body, bodySize);
+				m_deltaBytes += bodySize;
+				m_deltaCount++;
+			}
+		}
+		if (kind != KIND_DELTA) {
+			kind = KIND_KEYFRAME;
+			addState(id, 0, 0, size, data, size);
+			m_deltaBytes = 0;
+			m_keyframeCount++;
+		}
+		m_previous = id;
+		m_previousData.assign(data, data + size);
+	}
+
+	// Compress the body, when it makes it smaller.
+	uint8_t flags = 0;
+	const uint8_t* stored = body;
+	size_t storedSize = bodySize;
+	if (m_compress && bodySize > 0) {
+		m_compressed.resize(LZ4::compressBound(bodySize));
+		size_t compressedSize = LZ4::compress(body, bodySize, m_compressed.data());
+		if (compressedSize < bodySize) {
+			flags |= FLAG_COMPRESSED;
+			stored = m_compressed.data();
+			storedSize = compressedSize;
+		}
+	}
+
+	uint8_t header[HEADER_SIZE];
+	header[0] = kind;
+	header[1] = flags;
+	writeUint32(header + 2, m_session);
+	writeUint32(header + 6, id);
+	writeUint32(header + 10, base);
+	writeUint32(header + 14, static_cast<uint32_t>(size));
+	writeUint32(header + 18, static_cast<uint32_t>(bodySize));
+	output.clear();
+	output.write(header, HEADER_SIZE);
+	output.write(stored, storedSize);
+
+	m_frames++;
+	m_lastBytes = output.getSize();
+	m_lastRawBytes = static_cast<int>(size);
+	m_totalBytes += m_lastBytes;
+	m_totalRawBytes += m_lastRawBytes;
+}
+
+bool SavestateEncoder::decode(const uint8_t* data, size_t size, ByteData& output) {
+	output.clear();
+	m_error.clear();
+	if (data == NULL || size < HEADER_SIZE) {
+		m_error = "The savestate is invalid.";
+		return false;
+	}
+
+	uint8_t kind = data[0];
+	uint8_t flags = data[1];
+	uint32_t session = readUint32(data + 2);
+	uint32_t id = readUint32(data + 6);
+	uint32_t base = readUint32(data + 10);
+	size_t stateSize = readUint32(data + 14);
+	size_t bodySize = readUint32(data + 18);
+	const uint8_t* body = data + HEADER_SIZE;
+	size_t storedSize = size - HEADER_SIZE;
+
+	if (kind == KIND_DELTA && session != m_session) {
+		m_error = "The savestate only holds the changes from a state of an earlier session, so it can't be loaded.";
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] %s", m_error.c_str());
+		return false;
+	}
+
+	// The state the frontend asked for last is already at hand, as with run-ahead.
+	if (kind == KIND_DELTA && id == m_previous && m_previousData.size() == stateSize) {
+		output.write(m_previousData.data(), m_previousData.size());
+		output.seek(0);
+		return true;
+	}
+
+	if (flags & FLAG_COMPRESSED) {
+		if (bodySize > LZ4::decompressBound(storedSize)) {
+			m_error = "The savestate is invalid.";
+			pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] The savestate claims a larger size than it can hold.");
+			return false;
+		}
+		m_compressed.resize(bodySize);
+		if (!LZ4::decompress(body, storedSize, m_compressed.data(), bodySize)) {
+			m_error = "The savestate is invalid.";
+			pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Failed to decompress the savestate.");
+			return false;
+		}
+		body = m_compressed.data();
+	} else if (storedSize < bodySize) {
+		m_error = "The savestate is invalid.";
+		return false;
+	}
+
+	switch (kind) {
+		case KIND_RAW:
+		case KIND_KEYFRAME:
+			if (bodySize != stateSize) {
+				m_error = "The savestate is invalid.";
+				return false;
+			}
+			if (kind == KIND_KEYFRAME) {
+				// Keyframes from earlier sessions are given a new id, so that the next deltas can be taken against them.
+				if (session != m_session) {
+					id = m_nextID++;
+				}
+				if (m_states.find(id) == m_states.end()) {
+					addState(id, 0, 0, stateSize, body, stateSize);
+				}
+				m_previous = id;
+				m_previousData.assign(body, body + stateSize);
+				m_deltaBytes = 0;
+			}
+			output.write(body, stateSize);
+			break;
+		case KIND_DELTA: {
+			size_t deltaBytes;
+			std::map<uint32_t, State>::iterator baseState = m_states.find(base);
+			if (baseState == m_states.end() || !rebuild(base, &m_body, &deltaBytes)) {
+				m_error = "The savestate is too old to be loaded.";
+				pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] State %u of the savestate is no longer available.", base);
+				return false;
+			}
+			if (!readDelta(body, bodySize, m_body, stateSize, &m_rebuilt)) {
+				m_error = "The savestate is invalid.";
+				return false;
+			}
+			if (m_states.find(id) == m_states.end()) {
+				addState(id, base, baseState->second.depth + 1, stateSize, body, bodySize);
+			}
+			m_previous = id;
+			m_previousData.swap(m_rebuilt);
+			m_deltaBytes = deltaBytes + bodySize;
+			output.write(m_previousData.data(), m_previousData.size());
+			break;
+		}
+		default:
+			m_error = "The savestate is invalid.";
+			return false;
+	}
+
+	output.seek(0);
+	return true;
+}
+
+std::map<std::string, int> SavestateEncoder::getStats() {
+	std::map<std::string, int> stats;
+	stats["frames"] = m_frames;
+	stats["keyframes"] = m_keyframeCount;
+	stats["deltas"] = m_deltaCount;
+	stats["keyframesInMemory"] = static_cast<int>(m_keyframes.size());
+	stats["bytes"] = m_lastBytes;
+	stats["rawBytes"] = m_lastRawBytes;
+	stats["averageBytes"] = m_frames > 0 ? static_cast<int>(m_totalBytes / m_frames) : 0;
+	stats["averageRawBytes"] = m_frames > 0 ? static_cast<int>(m_totalRawBytes / m_frames) : 0;
+	return stats;
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
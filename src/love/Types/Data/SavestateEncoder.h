@@ -0,0 +1,144 @@
+#ifndef SRC_LOVE_TYPES_DATA_SAVESTATEENCODER_H_
+#define SRC_LOVE_TYPES_DATA_SAVESTATEENCODER_H_
+
+#include <stdint.h>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ByteData.h"
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * Encodes savestates as deltas against the previous state, optionally compressed with LZ4.
+ *
+ * A keyframe holds the full state. The states after it hold only the bytes that changed since the state before them, as runs of XORed bytes, which keeps the states small when only a little of the game changes each frame. A new keyframe is written when a delta wouldn't be smaller than the state, and at least every 60 states.
+ *
+ * The keyframes and deltas are kept in memory, so that any of them can be loaded again by applying the deltas since their keyframe. This makes delta states suited to rewind and run-ahead within the running session. A delta state from an earlier session, or whose keyframe is no longer in memory, cannot be loaded.
+ *
+ * Enabled from conf() with the "savestatedelta" and "savestatecompress" options.
+ *
+ * @see love.data.getSavestateStats
+ */
+class SavestateEncoder {
+	public:
+	/**
+	 * The number of bytes that each encoded state starts with.
+	 */
+	static const size_t HEADER_SIZE = 22;
+
+	SavestateEncoder();
+
+	/**
+	 * Whether or not to write deltas between the keyframes.
+	 */
+	void setDelta(bool delta);
+
+	/**
+	 * Whether or not to compress the states with LZ4.
+	 */
+	void setCompress(bool compress);
+
+	/**
+	 * Whether or not the states are encoded at all.
+	 */
+	bool isEnabled();
+
+	/**
+	 * Encodes the given state.
+	 *
+	 * @param data The state to encode.
+	 * @param size The size of the state in bytes.
+	 * @param output Receives the encoded state.
+	 */
+	void encode(const uint8_t* data, size_t size, ByteData& output);
+
+	/**
+	 * Decodes the given encoded state.
+	 *
+	 * @return False if the state is invalid, or its keyframe is no longer available.
+	 */
+	bool decode(const uint8_t* data, size_t size, ByteData& output);
+
+	/**
+	 * Gets why the last state failed to decode, to show to the player.
+	 */
+	std::string getError();
+
+	/**
+	 * Gets the statistics of the encoded states.
+	 */
+	std::map<std::string, int> getStats();
+
+	private:
+	enum Kind {
+		KIND_RAW = 0,
+		KIND_KEYFRAME,
+		KIND_DELTA
+	};
+
+	/**
+	 * A state kept in memory, either a keyframe with the full state, or the delta against its base state.
+	 */
+	struct State {
+		uint32_t base;
+		int depth;
+		size_t size;
+		std::vector<uint8_t> data;
+	};
+
+	/**
+	 * Keeps the given state, dropping the oldest keyframe and the states after it when they take up too much memory.
+	 */
+	void addState(uint32_t id, uint32_t base, int depth, size_t size, const uint8_t* data, size_t dataSize);
+
+	/**
+	 * Rebuilds the given state from its keyframe and the deltas since.
+	 */
+	bool rebuild(uint32_t id, std::vector<uint8_t>* output, size_t* deltaBytes);
+
+	/**
+	 * Writes the runs of bytes that differ between the state and its base.
+	 */
+	void writeDelta(const uint8_t* data, size_t size, const std::vector<uint8_t>& base, std::vector<uint8_t>* output);
+	bool readDelta(const uint8_t* data, size_t size, const std::vector<uint8_t>& base, size_t stateSize, std::vector<uint8_t>* output);
+
+	bool m_delta = false;
+	bool m_compress = false;
+	uint32_t m_session;
+	std::map<uint32_t, State> m_states;
+	std::list<uint32_t> m_keyframes;
+	size_t m_storedBytes = 0;
+	uint32_t m_nextID = 1;
+
+	/**
+	 * The last state that was encoded or decoded, which the next delta is taken against.
+	 */
+	uint32_t m_previous = 0;
+	std::vector<uint8_t> m_previousData;
+	size_t m_deltaBytes = 0;
+
+	std::vector<uint8_t> m_body;
+	std::vector<uint8_t> m_compressed;
+	std::vector<uint8_t> m_rebuilt;
+	std::vector<const State*> m_chain;
+	std::string m_error;
+
+	int m_frames = 0;
+	int m_keyframeCount = 0;
+	int m_deltaCount = 0;
+	int m_lastBytes = 0;
+	int m_lastRawBytes = 0;
+	int64_t m_totalBytes = 0;
+	int64_t m_totalRawBytes = 0;
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_SAVESTATEENCODER_H_
@@ -0,0 +1,141 @@
+#include "Struct.h"
+#include <map>
+#include <string>
+#include <vector>
+#include "pntr_app.h"
+
+namespace love {
+namespace Types {
+namespace Data {
+
+StructType::StructType(const std::string& name, const std::vector<std::string>& fields) : m_name(name), m_declarations(fields) {
+	for (const std::string& declaration : fields) {
+		// Split the declaration into its name and type.
+		std::string fieldName(declaration);
+		std::string typeName("float");
+		size_t separator = declaration.find(':');
+		if (separator != std::string::npos) {
+			fieldName = declaration.substr(0, separator);
+			typeName = declaration.substr(separator + 1);
+		}
+
+		Field field;
+		field.name = fieldName;
+		if (typeName == "float") {
+			field.type = FIELD_FLOAT;
+		} else if (typeName == "int") {
+			field.type = FIELD_INT;
+		} else if (typeName == "bool") {
+			field.type = FIELD_BOOL;
+		} else if (typeName == "string") {
+			field.type = FIELD_STRING;
+		} else {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Unknown type %s for field %s of %s.", typeName.c_str(), fieldName.c_str(), name.c_str());
+			m_valid = false;
+			continue;
+		}
+
+		int fieldID = getFieldID(fieldName);
+		if (fieldName.empty() || getField(fieldID) != NULL) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Invalid or duplicate field '%s' in %s.", fieldName.c_str(), name.c_str());
+			m_valid = false;
+			continue;
+		}
+
+		field.slot = field.type == FIELD_STRING ? m_strings++ : m_slots++;
+		if (fieldID >= static_cast<int>(m_fieldIndex.size())) {
+			m_fieldIndex.resize(fieldID + 1, -1);
+		}
+		m_fieldIndex[fieldID] = static_cast<int>(m_fields.size());
+		m_fields.push_back(field);
+	}
+}
+
+bool StructType::isValid() {
+	return m_valid && !m_fields.empty();
+}
+
+const std::string& StructType::getName() const {
+	return m_name;
+}
+
+const std::vector<std::string>& StructType::getFields() const {
+	return m_declarations;
+}
+
+const StructType::Field* StructType::getField(int fieldID) const {
+	if (fieldID < 0 || fieldID >= static_cast<int>(m_fieldIndex.size()) || m_fieldIndex[fieldID] < 0) {
+		return NULL;
+	}
+	return &m_fields[m_fieldIndex[fieldID]];
+}
+
+const std::vector<StructType::Field>& StructType::getFieldList() const {
+	return m_fields;
+}
+
+int StructType::getSlotCount() const {
+	return m_slots;
+}
+
+int StructType::getStringCount() const {
+	return m_strings;
+}
+
+int StructType::getFieldID(const std::string& name) {
+	static std::map<std::string, int> fieldIDs;
+	std::map<std::string, int>::iterator found = fieldIDs.find(name);
+	if (found != fieldIDs.end()) {
+		return found->second;
+	}
+	int fieldID = static_cast<int>(fieldIDs.size());
+	fieldIDs[name] = fieldID;
+	return fieldID;
+}
+
+Struct::Struct(const StructType* type) : m_type(type), m_slots(type->getSlotCount()), m_strings(type->getStringCount()) {
+	// Clear all the number and boolean fields.
+	for (const StructType::Field& field : type->getFieldList()) {
+		switch (field.type) {
+			case StructType::FIELD_FLOAT:
+				m_slots[field.slot].f = 0.0f;
+				break;
+			case StructType::FIELD_INT:
+				m_slots[field.slot].i = 0;
+				break;
+			case StructType::FIELD_BOOL:
+				m_slots[field.slot].b = false;
+				break;
+			case StructType::FIELD_STRING:
+				break;
+		}
+	}
+}
+
+const StructType* Struct::getType() const {
+	return m_type;
+}
+
+std::string Struct::getTypeName() const {
+	return m_type->getName();
+}
+
+float& Struct::getFloat(int slot) {
+	return m_slots[slot].f;
+}
+
+int& Struct::getInt(int slot) {
+	return m_slots[slot].i;
+}
+
+bool& Struct::getBool(int slot) {
+	return m_slots[slot].b;
+}
+
+std::string& Struct::getString(int slot) {
+	return m_strings[slot];
+}
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
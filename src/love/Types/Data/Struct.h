@@ -0,0 +1,141 @@
+#ifndef SRC_LOVE_TYPES_DATA_STRUCT_H_
+#define SRC_LOVE_TYPES_DATA_STRUCT_H_
+
+#include <string>
+#include <vector>
+
+namespace love {
+namespace Types {
+namespace Data {
+
+/**
+ * The fixed layout of a record type, declared with love.data.newStruct().
+ *
+ * Each field is declared as "name:type", where the type is one of float, int, bool or string. Fields without a type are floats.
+ *
+ * @code
+ * love.data.newStruct("Sprite", ["x:float", "y:float", "frame:int", "visible:bool", "name:string"])
+ *
+ * var sprite = Sprite()
+ * sprite.x = 10.0f
+ * sprite.visible = true
+ * @endcode
+ *
+ * @see love.data.newStruct
+ */
+class StructType {
+	public:
+	enum FieldType {
+		FIELD_FLOAT,
+		FIELD_INT,
+		FIELD_BOOL,
+		FIELD_STRING
+	};
+
+	/**
+	 * A field of the record, along with its slot in the record storage.
+	 */
+	struct Field {
+		std::string name;
+		FieldType type;
+		int slot;
+	};
+
+	StructType(const std::string& name, const std::vector<std::string>& fields);
+
+	/**
+	 * Whether or not all the fields were declared correctly.
+	 */
+	bool isValid();
+
+	/**
+	 * Gets the name of the record type.
+	 */
+	const std::string& getName() const;
+
+	/**
+	 * Gets the declarations of the fields, as they were given to newStruct().
+	 */
+	const std::vector<std::string>& getFields() const;
+
+	/**
+	 * Gets the field with the given field ID, or NULL if the record doesn't have it.
+	 *
+	 * @see getFieldID
+	 */
+	const Field* getField(int fieldID) const;
+
+	/**
+	 * Gets all the fields of the record type.
+	 */
+	const std::vector<Field>& getFieldList() const;
+
+	/**
+	 * Gets the number of number and boolean slots of each record.
+	 */
+	int getSlotCount() const;
+
+	/**
+	 * Gets the number of string slots of each record.
+	 */
+	int getStringCount() const;
+
+	/**
+	 * Gets the global ID of the given field name, which is shared between all record types.
+	 */
+	static int getFieldID(const std::string& name);
+
+	private:
+	std::string m_name;
+	std::vector<std::string> m_declarations;
+	std::vector<Field> m_fields;
+	std::vector<int> m_fieldIndex;
+	int m_slots = 0;
+	int m_strings = 0;
+	bool m_valid = true;
+};
+
+/**
+ * An instance of a record type, with its fields stored in fixed slots.
+ *
+ * @see StructType
+ */
+class Struct {
+	public:
+	/**
+	 * The storage of a number or boolean field.
+	 */
+	union Slot {
+		float f;
+		int i;
+		bool b;
+	};
+
+	Struct(const StructType* type);
+
+	/**
+	 * Gets the record type of the instance.
+	 */
+	const StructType* getType() const;
+
+	/**
+	 * Gets the name of the record type.
+	 */
+	std::string getTypeName() const;
+
+	float& getFloat(int slot);
+	int& getInt(int slot);
+	bool& getBool(int slot);
+	std::string& getString(int slot);
+
+	private:
+	const StructType* m_type;
+	std::vector<Slot> m_slots;
+	std::vector<std::string> m_strings;
+};
+
+}  // namespace Data
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_DATA_STRUCT_H_
@@ -0,0 +1,183 @@
+#include "World.h"
+#include <cmath>
+#include <string>
+#include <vector>
+#include <map>
+
+#include "pntr_app.h"
+#include "../../../ChaiLove.h"
+
+namespace love {
+namespace Types {
+namespace ECS {
+
+bool World::addComponent(const std::string& name, const std::vector<std::string>& fields) {
+	if (fields.empty() || hasComponent(name)) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [ecs] Component %s already exists, or has no fields.", name.c_str());
+		return false;
+	}
+
+	std::vector<int>& component = m_components[name];
+	for (const std::string& field : fields) {
+		int handle = static_cast<int>(m_fields.size());
+		m_fields.push_back(std::vector<float>(m_count, 0.0f));
+		m_fieldNames[name + "." + field] = handle;
+		component.push_back(handle);
+	}
+	return true;
+}
+
+bool World::hasComponent(const std::string& name) {
+	return m_components.find(name) != m_components.end();
+}
+
+int World::spawn() {
+	return spawn(1);
+}
+
+int World::spawn(int count) {
+	int first = m_count;
+	if (count <= 0) {
+		return first;
+	}
+	m_count += count;
+	for (std::vector<float>& field : m_fields) {
+		field.resize(m_count, 0.0f);
+	}
+	return first;
+}
+
+bool World::remove(int index) {
+	if (index < 0 || index >= m_count) {
+		return false;
+	}
+	m_count--;
+	for (std::vector<float>& field : m_fields) {
+		field[index] = field[m_count];
+		field.pop_back();
+	}
+	return true;
+}
+
+World& World::clear() {
+	m_count = 0;
+	for (std::vector<float>& field : m_fields) {
+		field.clear();
+	}
+	return *this;
+}
+
+int World::getCount() {
+	return m_count;
+}
+
+int World::getField(const std::string& component, const std::string& field) {
+	std::map<std::string, int>::iterator found = m_fieldNames.find(component + "." + field);
+	if (found == m_fieldNames.end()) {
+		return -1;
+	}
+	return found->second;
+}
+
+float World::get(int field, int index) {
+	if (field < 0 || field >= static_cast<int>(m_fields.size()) || index < 0 || index >= m_count) {
+		return 0.0f;
+	}
+	return m_fields[field][index];
+}
+
+float World::get(const std::string& component, const std::string& field, int index) {
+	return get(getField(component, field), index);
+}
+
+World& World::set(int field, int index, float value) {
+	if (field >= 0 && field < static_cast<int>(m_fields.size()) && index >= 0 && index < m_count) {
+		m_fields[field][index] = value;
+	}
+	return *this;
+}
+
+World& World::set(const std::string& component, const std::string& field, int index, float value) {
+	return set(getField(component, field), index, value);
+}
+
+bool World::getXY(const std::string& component, float** x, float** y) {
+	std::map<std::string, std::vector<int> >::iterator found = m_components.find(component);
+	if (found == m_components.end() || found->second.size() < 2) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [ecs] Component %s needs at least two fields.", component.c_str());
+		return false;
+	}
+	*x = m_fields[found->second[0]].data();
+	*y = m_fields[found->second[1]].data();
+	return true;
+}
+
+World& World::integrate(const std::string& position, const std::string& velocity, float dt) {
+	float *px, *py, *vx, *vy;
+	if (!getXY(position, &px, &py) || !getXY(velocity, &vx, &vy)) {
+		return *this;
+	}
+	for (int i = 0; i < m_count; i++) {
+		px[i] += vx[i] * dt;
+	}
+	for (int i = 0; i < m_count; i++) {
+		py[i] += vy[i] * dt;
+	}
+	return *this;
+}
+
+World& World::accelerate(const std::string& velocity, float x, float y, float dt) {
+	float *vx, *vy;
+	if (!getXY(velocity, &vx, &vy)) {
+		return *this;
+	}
+	float ax = x * dt;
+	float ay = y * dt;
+	for (int i = 0; i < m_count; i++) {
+		vx[i] += ax;
+		vy[i] += ay;
+	}
+	return *this;
+}
+
+World& World::bounce(const std::string& position, const std::string& velocity, float minX, float minY, float maxX, float maxY, float restitution) {
+	float *px, *py, *vx, *vy;
+	if (!getXY(position, &px, &py) || !getXY(velocity, &vx, &vy)) {
+		return *this;
+	}
+	for (int i = 0; i < m_count; i++) {
+		// Point the velocity away from the edge, so an entity that is still
+		// outside on the next step isn't flipped back out again.
+		if (px[i] > maxX) {
+			px[i] = maxX;
+			vx[i] = -fabsf(vx[i]) * restitution;
+		} else if (px[i] < minX) {
+			px[i] = minX;
+			vx[i] = fabsf(vx[i]) * restitution;
+		}
+		if (py[i] > maxY) {
+			py[i] = maxY;
+			vy[i] = -fabsf(vy[i]) * restitution;
+		} else if (py[i] < minY) {
+			py[i] = minY;
+			vy[i] = fabsf(vy[i]) * restitution;
+		}
+	}
+	return *this;
+}
+
+World& World::draw(Image* image, const std::string& position) {
+	float *px, *py;
+	if (image == NULL || !image->loaded() || !getXY(position, &px, &py)) {
+		return *this;
+	}
+	pntr_image* screen = ChaiLove::getInstance()->graphics.getScreen();
+	for (int i = 0; i < m_count; i++) {
+		pntr_draw_image(screen, image->surface, static_cast<int>(px[i]), static_cast<int>(py[i]));
+	}
+	return *this;
+}
+
+}  // namespace ECS
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,170 @@
+#ifndef SRC_LOVE_TYPES_ECS_WORLD_H_
+#define SRC_LOVE_TYPES_ECS_WORLD_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../Graphics/Image.h"
+
+using love::Types::Graphics::Image;
+
+namespace love {
+namespace Types {
+namespace ECS {
+
+/**
+ * A collection of entities, with their components stored natively as contiguous arrays.
+ *
+ * Components are declared with the names of their fields, which are all stored as floats. Each field is kept in its own array, indexed by entity, so the built-in systems run as tight native loops over all entities at once.
+ *
+ * Entities are identified by their index, from 0 to getCount() - 1. Removing an entity moves the last entity into its place.
+ *
+ * @code
+ * global world = love.ecs.newWorld()
+ * world.addComponent("position", ["x", "y"])
+ * world.addComponent("velocity", ["x", "y"])
+ *
+ * var bunny = world.spawn()
+ * world.set("velocity", "x", bunny, 100.0f)
+ *
+ * def update(dt) {
+ *   world.accelerate("velocity", 0.0f, 98.0f, dt)
+ *   world.integrate("position", "velocity", dt)
+ *   world.bounce("position", "velocity", 0.0f, 0.0f, 800.0f, 600.0f, 0.9f)
+ * }
+ *
+ * def draw() {
+ *   world.draw(bunnyImage, "position")
+ * }
+ * @endcode
+ */
+class World {
+	public:
+	/**
+	 * Declares a new component, with the given fields.
+	 *
+	 * @param name The name of the component.
+	 * @param fields The names of the fields of the component. The built-in systems use the first two fields as x and y.
+	 *
+	 * @return True if the component was added, false if it already exists or has no fields.
+	 */
+	bool addComponent(const std::string& name, const std::vector<std::string>& fields);
+
+	/**
+	 * Whether or not the given component has been declared.
+	 */
+	bool hasComponent(const std::string& name);
+
+	/**
+	 * Adds a new entity, with all its fields set to 0.
+	 *
+	 * @return The index of the new entity.
+	 */
+	int spawn();
+
+	/**
+	 * Adds the given number of entities, with all their fields set to 0.
+	 *
+	 * @return The index of the first new entity.
+	 */
+	int spawn(int count);
+
+	/**
+	 * Removes the given entity, by moving the last entity into its index.
+	 *
+	 * @return True if the entity was removed.
+	 */
+	bool remove(int index);
+
+	/**
+	 * Removes all the entities, while keeping the declared components.
+	 */
+	World& clear();
+
+	/**
+	 * Gets the number of entities.
+	 */
+	int getCount();
+
+	/**
+	 * Gets a handle to the given component field, for use with get() and set() without looking up the names.
+	 *
+	 * @return The field handle, or -1 if the component or field does not exist.
+	 */
+	int getField(const std::string& component, const std::string& field);
+
+	/**
+	 * Gets the value of a field of the given entity.
+	 *
+	 * @param field The field handle from getField().
+	 * @param index The index of the entity.
+	 */
+	float get(int field, int index);
+	float get(const std::string& component, const std::string& field, int index);
+
+	/**
+	 * Sets the value of a field of the given entity.
+	 *
+	 * @param field The field handle from getField().
+	 * @param index The index of the entity.
+	 * @param value The new value of the field.
+	 *
+	 * @return The world, to allow for method chaining.
+	 */
+	World& set(int field, int index, float value);
+	World& set(const std::string& component, const std::string& field, int index, float value);
+
+	/**
+	 * Moves the position of each entity by its velocity.
+	 *
+	 * @param position The name of the position component.
+	 * @param velocity The name of the velocity component.
+	 * @param dt The amount of time to move by.
+	 *
+	 * @return The world, to allow for method chaining.
+	 */
+	World& integrate(const std::string& position, const std::string& velocity, float dt);
+
+	/**
+	 * Adds the given acceleration to the velocity of each entity.
+	 *
+	 * @return The world, to allow for method chaining.
+	 */
+	World& accelerate(const std::string& velocity, float x, float y, float dt);
+
+	/**
+	 * Keeps each entity within the given bounds, by pointing its velocity back inside when it leaves them.
+	 *
+	 * @param position The name of the position component.
+	 * @param velocity The name of the velocity component.
+	 * @param restitution The amount of the velocity that is kept after bouncing.
+	 *
+	 * @return The world, to allow for method chaining.
+	 */
+	World& bounce(const std::string& position, const std::string& velocity, float minX, float minY, float maxX, float maxY, float restitution);
+
+	/**
+	 * Draws the given image at the position of each entity.
+	 *
+	 * @return The world, to allow for method chaining.
+	 */
+	World& draw(Image* image, const std::string& position);
+
+	private:
+	/**
+	 * Gets the first two field arrays of the given component, or false if the component doesn't have them.
+	 */
+	bool getXY(const std::string& component, float** x, float** y);
+
+	std::vector<std::vector<float> > m_fields;
+	std::map<std::string, std::vector<int> > m_components;
+	std::map<std::string, int> m_fieldNames;
+	int m_count = 0;
+};
+
+}  // namespace ECS
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_ECS_WORLD_H_
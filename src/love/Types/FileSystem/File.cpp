@@ -0,0 +1,205 @@
+#include "File.h"
+#include <string>
+#include "physfs.h"
+#include "pntr_app.h"
+#include "../Data/ByteData.h"
+#include "../../../ChaiLove.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+File::File(const std::string& filename) : m_filename(filename) {
+	// Nothing.
+}
+
+File::~File() {
+	close();
+}
+
+bool File::open(const std::string& mode) {
+	if (isOpen()) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] File %s is already open", m_filename.c_str());
+		return false;
+	}
+
+	if (mode == "r") {
+		m_file = PHYSFS_openRead(m_filename.c_str());
+	} else if (mode == "w") {
+		m_file = PHYSFS_openWrite(m_filename.c_str());
+	} else if (mode == "a") {
+		m_file = PHYSFS_openAppend(m_filename.c_str());
+	} else {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Invalid file mode %s, expected r, w or a", mode.c_str());
+		return false;
+	}
+
+	if (m_file == NULL) {
+		logError("opening");
+		return false;
+	}
+	m_mode = mode;
+
+	// Writes are gathered in a buffer, so that small writes every frame don't each reach the disk.
+	if (m_mode != "r") {
+		invalidate();
+		setBuffer(m_bufferSize > 0 ? m_bufferSize : DEFAULT_BUFFER_SIZE);
+	} else if (m_bufferSize > 0) {
+		setBuffer(m_bufferSize);
+	}
+	return true;
+}
+
+bool File::close() {
+	if (m_file == NULL) {
+		return true;
+	}
+
+	// Closing flushes the buffer. When that fails, PhysFS leaves the file open, so keep it for another try.
+	if (PHYSFS_close(m_file) == 0) {
+		logError("closing");
+		return false;
+	}
+	m_file = NULL;
+	if (m_mode != "r") {
+		invalidate();
+	}
+	m_mode = "c";
+	return true;
+}
+
+bool File::isOpen() {
+	return m_file != NULL;
+}
+
+std::string File::getMode() {
+	return m_mode;
+}
+
+std::string File::getFilename() {
+	return m_filename;
+}
+
+bool File::write(const std::string& data) {
+	return write(data.data(), data.size());
+}
+
+bool File::write(ByteData& data) {
+	return write(data.getPointer(), static_cast<size_t>(data.getSize()));
+}
+
+bool File::write(const void* data, size_t size) {
+	if (m_file == NULL || m_mode == "r") {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] File %s is not open for writing", m_filename.c_str());
+		return false;
+	}
+	if (PHYSFS_writeBytes(m_file, data, size) != static_cast<PHYSFS_sint64>(size)) {
+		logError("writing");
+		return false;
+	}
+	return true;
+}
+
+std::string File::read() {
+	if (m_file == NULL) {
+		return "";
+	}
+	PHYSFS_sint64 size = PHYSFS_fileLength(m_file);
+	PHYSFS_sint64 position = PHYSFS_tell(m_file);
+	if (size < 0 || position < 0 || position >= size) {
+		return "";
+	}
+	return read(static_cast<int>(size - position));
+}
+
+std::string File::read(int bytes) {
+	if (m_file == NULL || m_mode != "r") {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] File %s is not open for reading", m_filename.c_str());
+		return "";
+	}
+	if (bytes <= 0) {
+		return "";
+	}
+
+	std::string output;
+	output.resize(static_cast<size_t>(bytes));
+	PHYSFS_sint64 bytesRead = PHYSFS_readBytes(m_file, &output[0], static_cast<PHYSFS_uint64>(bytes));
+	if (bytesRead < 0) {
+		logError("reading");
+		return "";
+	}
+	output.resize(static_cast<size_t>(bytesRead));
+	return output;
+}
+
+bool File::flush() {
+	if (m_file == NULL || m_mode == "r") {
+		return false;
+	}
+	if (PHYSFS_flush(m_file) == 0) {
+		logError("flushing");
+		return false;
+	}
+	invalidate();
+	return true;
+}
+
+bool File::setBuffer(int size) {
+	if (size < 0) {
+		return false;
+	}
+	m_bufferSize = size;
+	if (m_file == NULL) {
+		return true;
+	}
+	if (PHYSFS_setBuffer(m_file, static_cast<PHYSFS_uint64>(size)) == 0) {
+		logError("setting the buffer of");
+		return false;
+	}
+	return true;
+}
+
+int File::getBuffer() {
+	return m_bufferSize;
+}
+
+int File::tell() {
+	if (m_file == NULL) {
+		return -1;
+	}
+	return static_cast<int>(PHYSFS_tell(m_file));
+}
+
+bool File::seek(int position) {
+	if (m_file == NULL || position < 0) {
+		return false;
+	}
+	return PHYSFS_seek(m_file, static_cast<PHYSFS_uint64>(position)) != 0;
+}
+
+bool File::isEOF() {
+	return m_file == NULL || PHYSFS_eof(m_file) != 0;
+}
+
+int File::getSize() {
+	if (m_file == NULL) {
+		return -1;
+	}
+	return static_cast<int>(PHYSFS_fileLength(m_file));
+}
+
+void File::invalidate() {
+	// The file may be closed as ChaiLove shuts down.
+	if (ChaiLove::hasInstance()) {
+		ChaiLove::getInstance()->filesystem.invalidate(m_filename);
+	}
+}
+
+void File::logError(const std::string& action) {
+	const char* error = PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode());
+	pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error %s %s: %s", action.c_str(), m_filename.c_str(), error != NULL ? error : "");
+}
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,155 @@
+#ifndef SRC_LOVE_TYPES_FILESYSTEM_FILE_H_
+#define SRC_LOVE_TYPES_FILESYSTEM_FILE_H_
+
+#include <string>
+#include "physfs.h"
+#include "../Data/ByteData.h"
+
+using love::Types::Data::ByteData;
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+/**
+ * An open file, which can be written to a piece at a time without opening it again for every write.
+ *
+ * Writes are buffered, and reach the disk when the buffer fills up, or when the file is flushed or closed.
+ *
+ * @code
+ * def load() {
+ *   log = love.filesystem.newFile("replay.log", "w")
+ * }
+ * def update(dt) {
+ *   log.write(to_string(dt) + "\n")
+ * }
+ * @endcode
+ *
+ * @see love.filesystem.newFile
+ */
+class File {
+	public:
+	/**
+	 * Creates a File for the given path, without opening it.
+	 */
+	File(const std::string& filename);
+	~File();
+
+	File(const File&) = delete;
+	File& operator=(const File&) = delete;
+
+	/**
+	 * Opens the file.
+	 *
+	 * @param mode "r" to read, "w" to write over the file, or "a" to write to the end of it. Files are written in the save directory.
+	 *
+	 * @return True if the file was opened.
+	 */
+	bool open(const std::string& mode);
+
+	/**
+	 * Flushes anything left in the buffer, and closes the file.
+	 *
+	 * @return True if the file was closed. When it couldn't be, the file stays open, so that it can be flushed or closed again.
+	 */
+	bool close();
+
+	/**
+	 * Whether or not the file is open.
+	 */
+	bool isOpen();
+
+	/**
+	 * Gets the mode the file was opened with, or "c" if it's closed.
+	 */
+	std::string getMode();
+
+	/**
+	 * Gets the path of the file.
+	 */
+	std::string getFilename();
+
+	/**
+	 * Writes a string to the file.
+	 *
+	 * @return True if all of the data was written.
+	 */
+	bool write(const std::string& data);
+
+	/**
+	 * Writes the contents of a ByteData to the file.
+	 */
+	bool write(ByteData& data);
+
+	/**
+	 * Reads the rest of the file, from a file opened with "r".
+	 */
+	std::string read();
+
+	/**
+	 * Reads up to the given number of bytes.
+	 */
+	std::string read(int bytes);
+
+	/**
+	 * Writes anything in the buffer to the disk.
+	 */
+	bool flush();
+
+	/**
+	 * Sets the size of the buffer, in bytes. A size of 0 turns off buffering.
+	 *
+	 * @return True if the buffer was set.
+	 */
+	bool setBuffer(int size);
+
+	/**
+	 * Gets the size of the buffer, in bytes.
+	 */
+	int getBuffer();
+
+	/**
+	 * Gets the position in the file, or -1 if it's closed.
+	 */
+	int tell();
+
+	/**
+	 * Moves to the given position in the file.
+	 */
+	bool seek(int position);
+
+	/**
+	 * Whether or not the end of the file has been reached.
+	 */
+	bool isEOF();
+
+	/**
+	 * Gets the size of the file in bytes, or -1 if it's closed.
+	 */
+	int getSize();
+
+	/**
+	 * The buffer given to files that are opened for writing.
+	 */
+	static const int DEFAULT_BUFFER_SIZE = 16 * 1024;
+
+	private:
+	bool write(const void* data, size_t size);
+
+	/**
+	 * Lets love.filesystem know that the file has changed.
+	 */
+	void invalidate();
+	void logError(const std::string& action);
+
+	std::string m_filename;
+	std::string m_mode = "c";
+	PHYSFS_File* m_file = NULL;
+	int m_bufferSize = 0;
+};
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_FILESYSTEM_FILE_H_
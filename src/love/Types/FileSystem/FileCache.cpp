@@ -0,0 +1,115 @@
+#include "FileCache.h"
+#include <list>
+#include <map>
+#include <string>
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+void FileCache::setBudget(size_t bytes) {
+	m_budget = bytes;
+	trim(m_budget);
+}
+
+size_t FileCache::getBudget() {
+	return m_budget;
+}
+
+bool FileCache::isEnabled() {
+	return m_budget > 0;
+}
+
+const std::string* FileCache::get(const std::string& path, const std::string& archive) {
+	std::map<std::string, std::list<Entry>::iterator>::iterator found = m_index.find(path);
+	if (found == m_index.end()) {
+		m_misses++;
+		return NULL;
+	}
+
+	// The path may now resolve to a different archive, which shadows the cached file.
+	if (found->second->archive != archive) {
+		erase(found->second);
+		m_misses++;
+		return NULL;
+	}
+
+	m_entries.splice(m_entries.begin(), m_entries, found->second);
+	m_hits++;
+	return &found->second->contents;
+}
+
+void FileCache::put(const std::string& path, const std::string& archive, const void* data, size_t size) {
+	evict(path);
+	if (size > m_budget) {
+		return;
+	}
+
+	// Make room for the file before adding it.
+	trim(m_budget - size);
+
+	Entry entry;
+	entry.path = path;
+	entry.archive = archive;
+	entry.contents.assign(static_cast<const char*>(data), size);
+	m_entries.push_front(entry);
+	m_index[path] = m_entries.begin();
+	m_bytes += size;
+}
+
+bool FileCache::evict(const std::string& path) {
+	std::map<std::string, std::list<Entry>::iterator>::iterator found = m_index.find(path);
+	if (found == m_index.end()) {
+		return false;
+	}
+	erase(found->second);
+	return true;
+}
+
+int FileCache::evictArchive(const std::string& archive) {
+	int count = 0;
+	std::list<Entry>::iterator it = m_entries.begin();
+	while (it != m_entries.end()) {
+		std::list<Entry>::iterator entry = it++;
+		if (entry->archive == archive) {
+			erase(entry);
+			count++;
+		}
+	}
+	return count;
+}
+
+void FileCache::clear() {
+	m_entries.clear();
+	m_index.clear();
+	m_bytes = 0;
+}
+
+std::map<std::string, int> FileCache::getStats() {
+	std::map<std::string, int> stats;
+	stats["hits"] = m_hits;
+	stats["misses"] = m_misses;
+	stats["evictions"] = m_evictions;
+	stats["files"] = static_cast<int>(m_entries.size());
+	stats["bytes"] = static_cast<int>(m_bytes);
+	stats["budget"] = static_cast<int>(m_budget);
+	return stats;
+}
+
+void FileCache::erase(std::list<Entry>::iterator entry) {
+	m_bytes -= entry->contents.size();
+	m_index.erase(entry->path);
+	m_entries.erase(entry);
+}
+
+void FileCache::trim(size_t budget) {
+	while (m_bytes > budget && !m_entries.empty()) {
+		std::list<Entry>::iterator last = m_entries.end();
+		erase(--last);
+		m_evictions++;
+	}
+}
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
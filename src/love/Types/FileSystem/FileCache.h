@@ -0,0 +1,98 @@
+#ifndef SRC_LOVE_TYPES_FILESYSTEM_FILECACHE_H_
+#define SRC_LOVE_TYPES_FILESYSTEM_FILECACHE_H_
+
+#include <stddef.h>
+#include <list>
+#include <map>
+#include <string>
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+/**
+ * Keeps the contents of recently read files in memory, so that files in compressed archives don't need to be inflated again.
+ *
+ * Files are keyed by their path, along with the archive or directory they were read from. When the cache is over its byte budget, the least recently used files are dropped first.
+ *
+ * @see love.filesystem.setCacheBudget
+ */
+class FileCache {
+	public:
+	/**
+	 * Sets the most bytes of file contents to keep. A budget of 0 disables the cache, and empties it.
+	 */
+	void setBudget(size_t bytes);
+	size_t getBudget();
+
+	/**
+	 * Whether or not the cache has a budget to keep files in.
+	 */
+	bool isEnabled();
+
+	/**
+	 * Finds the contents of a file, and marks it as the most recently used.
+	 *
+	 * @param path The path of the file.
+	 * @param archive The archive or directory that the path currently resolves to.
+	 *
+	 * @return The contents, or NULL if the file isn't cached from that archive. Valid until the cache is next changed.
+	 */
+	const std::string* get(const std::string& path, const std::string& archive);
+
+	/**
+	 * Adds the contents of a file, replacing any older contents for the same path. Files larger than the whole budget aren't kept.
+	 */
+	void put(const std::string& path, const std::string& archive, const void* data, size_t size);
+
+	/**
+	 * Removes the given file.
+	 *
+	 * @return True if the file was cached.
+	 */
+	bool evict(const std::string& path);
+
+	/**
+	 * Removes all the files that were read from the given archive.
+	 *
+	 * @return The number of files removed.
+	 */
+	int evictArchive(const std::string& archive);
+
+	/**
+	 * Removes all the files.
+	 */
+	void clear();
+
+	/**
+	 * Gets the number of "hits", "misses" and "evictions", along with the number of "files" and "bytes" held, and the "budget".
+	 */
+	std::map<std::string, int> getStats();
+
+	private:
+	struct Entry {
+		std::string path;
+		std::string archive;
+		std::string contents;
+	};
+
+	void erase(std::list<Entry>::iterator entry);
+	void trim(size_t budget);
+
+	/**
+	 * The files, from the most to the least recently used.
+	 */
+	std::list<Entry> m_entries;
+	std::map<std::string, std::list<Entry>::iterator> m_index;
+	size_t m_budget = 0;
+	size_t m_bytes = 0;
+	int m_hits = 0;
+	int m_misses = 0;
+	int m_evictions = 0;
+};
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_FILESYSTEM_FILECACHE_H_
@@ -1,6 +1,9 @@
 #include "FileData.h"
+#include <string.h>
+#include <memory>
 #include <string>
 
+#include "pntr_app.h"
 #include "../../../ChaiLove.h"
 
 namespace love {
@@ -11,25 +14,68 @@ FileData::FileData(const std::string& filepath) : m_filepath(filepath) {
 	// Nothing.
 }
 
-FileData::FileData(const std::string& contents, const std::string& name) : m_filepath(name), m_contents(contents) {
-	// Nothing.
+FileData::FileData(const std::string& contents, const std::string& name) : m_filepath(name), m_buffer(std::make_shared<FileBuffer>()) {
+	if (contents.empty()) {
+		return;
+	}
+	unsigned char* buffer = static_cast<unsigned char*>(pntr_load_memory(contents.size()));
+	if (buffer == NULL) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Not enough memory for the %u bytes of %s", static_cast<unsigned int>(contents.size()), name.c_str());
+		return;
+	}
+	memcpy(buffer, contents.data(), contents.size());
+	m_buffer->data.reset(buffer, pntr_unload_memory);
+	m_buffer->size = static_cast<unsigned int>(contents.size());
+}
+
+bool FileData::load() {
+	if (m_buffer != NULL) {
+		return true;
+	}
+
+	// Files stored uncompressed in a memory archive are used where they are, without a copy.
+	ChaiLove* app = ChaiLove::getInstance();
+	m_buffer = app->filesystem.getSharedView(m_filepath);
+	if (m_buffer != NULL) {
+		return true;
+	}
+
+	unsigned int size = 0;
+	unsigned char* buffer = pntr_load_file(m_filepath.c_str(), &size);
+	if (buffer == NULL) {
+		return false;
+	}
+	m_buffer = std::make_shared<FileBuffer>();
+	m_buffer->data.reset(buffer, pntr_unload_file);
+	m_buffer->size = size;
+	return true;
 }
 
 int FileData::getSize() {
+	if (m_buffer != NULL) {
+		return static_cast<int>(m_buffer->size);
+	}
 	ChaiLove* app = ChaiLove::getInstance();
 	return app->filesystem.getSize(m_filepath);
 }
 
+const unsigned char* FileData::getPointer() {
+	if (!load()) {
+		return NULL;
+	}
+	return m_buffer->data.get();
+}
+
 std::string FileData::getFilename() {
 	return m_filepath;
 }
 
 std::string FileData::getString() {
-	if (!m_contents.empty()) {
-		return m_contents;
+	const unsigned char* buffer = getPointer();
+	if (buffer == NULL) {
+		return "";
 	}
-	ChaiLove* app = ChaiLove::getInstance();
-	return m_contents = app->filesystem.read(m_filepath);
+	return std::string(reinterpret_cast<const char*>(buffer), m_buffer->size);
 }
 
 std::string FileData::getExtension() {
@@ -1,6 +1,7 @@
 #ifndef SRC_LOVE_TYPES_FILESYSTEM_FILEDATA_H_
 #define SRC_LOVE_TYPES_FILESYSTEM_FILEDATA_H_
 
+#include <memory>
 #include <string>
 
 namespace love {
@@ -8,7 +9,19 @@ namespace Types {
 namespace FileSystem {
 
 /**
- * Information about a file.
+ * The bytes of a loaded file, shared by the copies of a FileData.
+ */
+struct FileBuffer {
+	std::shared_ptr<unsigned char> data;
+	unsigned int size = 0;
+};
+
+/**
+ * The contents of a file.
+ *
+ * The file is loaded the first time its contents are needed, and stays in the buffer it was read into. Copies of a loaded FileData share that buffer, and Image, SoundData and Font can be created straight from it.
+ *
+ * Files stored uncompressed in an archive mounted from memory aren't copied at all. They are copied when the archive is unmounted instead, so that the FileData stays valid.
  *
  * @see love.filesystem.newFileData
  */
@@ -33,6 +46,13 @@ class FileData {
 	 */
 	int getSize();
 
+	/**
+	 * Gets the contents of the file, loading them if they aren't already.
+	 *
+	 * @return The contents, or NULL if the file couldn't be read. Valid as long as the FileData, or a copy of it, exists. Unmounting the archive the file is in copies the contents out of it first.
+	 */
+	const unsigned char* getPointer();
+
 	/**
 	 * Gets the filename of the FileData.
 	 */
@@ -49,7 +69,14 @@ class FileData {
 	std::string getExtension();
 
 	std::string m_filepath;
-	std::string m_contents;
+
+	private:
+	/**
+	 * Reads the file into the buffer, if it hasn't been read yet.
+	 */
+	bool load();
+
+	std::shared_ptr<FileBuffer> m_buffer;
 };
 
 }  // namespace FileSystem
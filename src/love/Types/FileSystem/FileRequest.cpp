@@ -0,0 +1,166 @@
+#include "FileRequest.h"
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include "physfs.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+FileRequest::FileRequest(Type type, const std::string& filename) : m_type(type), m_filename(filename) {
+	// Nothing.
+}
+
+FileRequest::~FileRequest() {
+	if (m_file != NULL) {
+		PHYSFS_close(m_file);
+	}
+}
+
+bool FileRequest::isDone() {
+	return m_done;
+}
+
+bool FileRequest::isSuccessful() {
+	return m_done && m_success;
+}
+
+std::string FileRequest::getFilename() {
+	return m_filename;
+}
+
+std::string FileRequest::getContents() {
+	return m_done ? m_contents : "";
+}
+
+std::vector<std::string> FileRequest::getItems() {
+	return m_done ? m_items : std::vector<std::string>();
+}
+
+std::string FileRequest::getError() {
+	return m_done ? m_error : "";
+}
+
+bool FileRequest::step(size_t* budget) {
+	switch (m_type) {
+		case REQUEST_READ: {
+			if (m_file == NULL && !open()) {
+				return true;
+			}
+			size_t count = m_contents.size() - m_position;
+			if (count > *budget) {
+				count = *budget;
+			}
+			if (count > 0) {
+				PHYSFS_sint64 bytesRead = PHYSFS_readBytes(m_file, &m_contents[m_position], static_cast<PHYSFS_uint64>(count));
+				if (bytesRead != static_cast<PHYSFS_sint64>(count)) {
+					fail();
+					m_contents.clear();
+					return true;
+				}
+				m_position += count;
+				*budget -= count;
+			}
+			if (m_position < m_contents.size()) {
+				return false;
+			}
+			PHYSFS_close(m_file);
+			m_file = NULL;
+			m_success = true;
+			return true;
+		}
+		case REQUEST_WRITE: {
+			if (m_file == NULL && !open()) {
+				std::string().swap(m_contents);
+				return true;
+			}
+			size_t count = m_contents.size() - m_position;
+			if (count > *budget) {
+				count = *budget;
+			}
+			if (count > 0) {
+				if (PHYSFS_writeBytes(m_file, m_contents.data() + m_position, count) != static_cast<PHYSFS_sint64>(count)) {
+					fail();
+					std::string().swap(m_contents);
+					return true;
+				}
+				m_position += count;
+				*budget -= count;
+			}
+			if (m_position < m_contents.size()) {
+				return false;
+			}
+			// PhysFS keeps the handle open when the last of its buffer can't be written, so leave it for the destructor to try again.
+			if (PHYSFS_close(m_file) == 0) {
+				const char* error = PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode());
+				m_error = error != NULL ? error : "Unknown error";
+			} else {
+				m_file = NULL;
+				m_success = true;
+			}
+
+			// The contents were only needed for writing.
+			std::string().swap(m_contents);
+			return true;
+		}
+		case REQUEST_DIRECTORY: {
+			char** files = PHYSFS_enumerateFiles(m_filename.c_str());
+			if (files == NULL) {
+				fail();
+				return true;
+			}
+			for (char** i = files; *i != NULL; i++) {
+				m_items.push_back(std::string(*i));
+			}
+			PHYSFS_freeList(files);
+			m_success = true;
+			return true;
+		}
+	}
+	return true;
+}
+
+void FileRequest::finish() {
+	m_done = true;
+	if (m_callback) {
+		m_callback(*this);
+	}
+}
+
+bool FileRequest::open() {
+	if (m_type == REQUEST_WRITE) {
+		m_file = PHYSFS_openWrite(m_filename.c_str());
+	} else {
+		m_file = PHYSFS_openRead(m_filename.c_str());
+	}
+	if (m_file == NULL) {
+		fail();
+		return false;
+	}
+
+	if (m_type == REQUEST_READ) {
+		const char* realDir = PHYSFS_getRealDir(m_filename.c_str());
+		m_archive = realDir != NULL ? realDir : "";
+		PHYSFS_sint64 size = PHYSFS_fileLength(m_file);
+		if (size < 0) {
+			fail();
+			return false;
+		}
+		m_contents.resize(static_cast<size_t>(size));
+	}
+	return true;
+}
+
+void FileRequest::fail() {
+	const char* error = PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode());
+	m_error = error != NULL ? error : "Unknown error";
+	if (m_file != NULL) {
+		PHYSFS_close(m_file);
+		m_file = NULL;
+	}
+}
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,121 @@
+#ifndef SRC_LOVE_TYPES_FILESYSTEM_FILEREQUEST_H_
+#define SRC_LOVE_TYPES_FILESYSTEM_FILEREQUEST_H_
+
+#include <stddef.h>
+#include <functional>
+#include <string>
+#include <vector>
+#include "physfs.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+/**
+ * A file operation that runs a piece at a time across frames, made with love.filesystem.readAsync(), writeAsync() or getDirectoryItemsAsync().
+ *
+ * A piece of each pending request runs at the start of every frame, before update(dt). The request is done, and its callback is called, in the same frame that its operation finishes, so a request made during update(dt) finishes on a later frame.
+ *
+ * @code
+ * def load() {
+ *   love.filesystem.readAsync("level2.txt", fun(request) {
+ *     if (request.isSuccessful()) {
+ *       level = request.getContents()
+ *     }
+ *   })
+ * }
+ * @endcode
+ *
+ * @see love.filesystem.readAsync
+ */
+class FileRequest {
+	public:
+	enum Type {
+		REQUEST_READ,
+		REQUEST_WRITE,
+		REQUEST_DIRECTORY
+	};
+
+	typedef std::function<void(FileRequest&)> Callback;
+
+	FileRequest(Type type, const std::string& filename);
+	~FileRequest();
+
+	FileRequest(const FileRequest&) = delete;
+	FileRequest& operator=(const FileRequest&) = delete;
+
+	/**
+	 * Whether or not the operation has finished.
+	 */
+	bool isDone();
+
+	/**
+	 * Whether or not the operation has finished without an error.
+	 */
+	bool isSuccessful();
+
+	/**
+	 * Gets the file or directory that the request is for.
+	 */
+	std::string getFilename();
+
+	/**
+	 * Gets the contents that were read, once the request is done.
+	 */
+	std::string getContents();
+
+	/**
+	 * Gets the files and directories that were found, once the request is done.
+	 */
+	std::vector<std::string> getItems();
+
+	/**
+	 * Gets the error message, once the request is done, if the operation failed.
+	 */
+	std::string getError();
+
+	/**
+	 * Runs part of the operation.
+	 *
+	 * @param budget The most bytes to read or write. Reduced by the bytes that were.
+	 *
+	 * @return True once the operation has finished.
+	 */
+	bool step(size_t* budget);
+
+	/**
+	 * Marks the request as done, and calls its callback.
+	 */
+	void finish();
+
+	Type m_type;
+	std::string m_filename;
+	std::string m_contents;
+	std::vector<std::string> m_items;
+
+	/**
+	 * The archive or directory that the file was read from, so that it can be cached.
+	 */
+	std::string m_archive;
+	std::string m_error;
+	Callback m_callback;
+
+	private:
+	bool open();
+	void fail();
+
+	PHYSFS_File* m_file = NULL;
+
+	/**
+	 * How many bytes have been read or written so far.
+	 */
+	size_t m_position = 0;
+	bool m_success = false;
+	bool m_done = false;
+};
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_FILESYSTEM_FILEREQUEST_H_
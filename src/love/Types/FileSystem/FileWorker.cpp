@@ -0,0 +1,41 @@
+#include "FileWorker.h"
+#include <stddef.h>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+void FileWorker::push(std::shared_ptr<FileRequest> request) {
+	m_pending.push_back(request);
+}
+
+std::vector<std::shared_ptr<FileRequest> > FileWorker::update(size_t budget) {
+	std::vector<std::shared_ptr<FileRequest> > finished;
+	while (!m_pending.empty()) {
+		if (!m_pending.front()->step(&budget)) {
+			// The budget ran out partway through the request.
+			break;
+		}
+		finished.push_back(m_pending.front());
+		m_pending.pop_front();
+		if (budget == 0) {
+			break;
+		}
+	}
+	return finished;
+}
+
+int FileWorker::getPendingCount() {
+	return static_cast<int>(m_pending.size());
+}
+
+void FileWorker::clear() {
+	m_pending.clear();
+}
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
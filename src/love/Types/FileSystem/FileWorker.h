@@ -0,0 +1,58 @@
+#ifndef SRC_LOVE_TYPES_FILESYSTEM_FILEWORKER_H_
+#define SRC_LOVE_TYPES_FILESYSTEM_FILEWORKER_H_
+
+#include <stddef.h>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "FileRequest.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+/**
+ * Runs file requests a slice at a time, in the order they were made.
+ *
+ * PhysFS is built without thread support, so the requests run on the main thread, with each frame doing no more than a set number of bytes of work.
+ */
+class FileWorker {
+	public:
+	/**
+	 * The most bytes read or written on each frame.
+	 */
+	static const size_t DEFAULT_BUDGET = 1024 * 1024;
+
+	/**
+	 * Queues a request.
+	 */
+	void push(std::shared_ptr<FileRequest> request);
+
+	/**
+	 * Runs the queued requests until the budget is spent.
+	 *
+	 * @param budget The most bytes to read or write.
+	 *
+	 * @return The requests that finished.
+	 */
+	std::vector<std::shared_ptr<FileRequest> > update(size_t budget);
+
+	/**
+	 * Gets the number of requests that haven't finished.
+	 */
+	int getPendingCount();
+
+	/**
+	 * Drops the queued requests, without running them.
+	 */
+	void clear();
+
+	private:
+	std::deque<std::shared_ptr<FileRequest> > m_pending;
+};
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_FILESYSTEM_FILEWORKER_H_
@@ -0,0 +1,100 @@
+#include "LineIterator.h"
+#include <string>
+#include "physfs.h"
+#include "pntr_app.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+namespace {
+
+const size_t LINE_ITERATOR_CHUNK_SIZE = 16 * 1024;
+
+}  // namespace
+
+LineIterator::LineIterator(const std::string& filename, const std::string& delimiter) : m_delimiter(delimiter) {
+	if (m_delimiter.empty()) {
+		m_delimiter = "\n";
+	}
+
+	m_file = PHYSFS_openRead(filename.c_str());
+	if (m_file == NULL) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error opening file %s: %s", filename.c_str(), PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+		m_finished = true;
+		return;
+	}
+
+	// An empty file has no lines.
+	if (!readChunk()) {
+		close();
+	}
+}
+
+LineIterator::~LineIterator() {
+	close();
+}
+
+bool LineIterator::hasNext() {
+	return !m_finished;
+}
+
+std::string LineIterator::next() {
+	if (m_finished) {
+		return "";
+	}
+
+	while (true) {
+		size_t found = m_buffer.find(m_delimiter, m_searchFrom);
+		if (found != std::string::npos) {
+			std::string line = m_buffer.substr(m_position, found - m_position);
+			m_position = found + m_delimiter.size();
+			m_searchFrom = m_position;
+			return line;
+		}
+
+		// The delimiter may be split between this chunk and the next, so search again from just before the end.
+		size_t searched = m_buffer.size() - m_position;
+		if (!readChunk()) {
+			std::string line = m_buffer.substr(m_position);
+			close();
+			return line;
+		}
+		size_t overlap = m_delimiter.size() - 1;
+		m_searchFrom = m_position + (searched > overlap ? searched - overlap : 0);
+	}
+}
+
+void LineIterator::close() {
+	if (m_file != NULL) {
+		PHYSFS_close(m_file);
+		m_file = NULL;
+	}
+	m_finished = true;
+	std::string().swap(m_buffer);
+	m_position = 0;
+	m_searchFrom = 0;
+}
+
+bool LineIterator::readChunk() {
+	if (m_file == NULL) {
+		return false;
+	}
+
+	// Drop the lines that were already read, so the buffer only grows with the length of a line.
+	if (m_position > 0) {
+		m_buffer.erase(0, m_position);
+		m_searchFrom -= m_position;
+		m_position = 0;
+	}
+
+	size_t size = m_buffer.size();
+	m_buffer.resize(size + LINE_ITERATOR_CHUNK_SIZE);
+	PHYSFS_sint64 bytesRead = PHYSFS_readBytes(m_file, &m_buffer[size], LINE_ITERATOR_CHUNK_SIZE);
+	m_buffer.resize(size + (bytesRead > 0 ? static_cast<size_t>(bytesRead) : 0));
+	return bytesRead > 0;
+}
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,82 @@
+#ifndef SRC_LOVE_TYPES_FILESYSTEM_LINEITERATOR_H_
+#define SRC_LOVE_TYPES_FILESYSTEM_LINEITERATOR_H_
+
+#include <string>
+#include "physfs.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+/**
+ * Reads the lines of a file one at a time, holding only a small part of the file in memory.
+ *
+ * @code
+ * var lines = love.filesystem.newLineIterator("level.csv")
+ * while (lines.hasNext()) {
+ *   var cells = lines.next().split(",")
+ * }
+ * @endcode
+ *
+ * @see love.filesystem.newLineIterator
+ */
+class LineIterator {
+	public:
+	/**
+	 * Opens the file to read its lines.
+	 *
+	 * @param filename The file to read.
+	 * @param delimiter The string that separates the lines.
+	 */
+	LineIterator(const std::string& filename, const std::string& delimiter);
+	~LineIterator();
+
+	LineIterator(const LineIterator&) = delete;
+	LineIterator& operator=(const LineIterator&) = delete;
+
+	/**
+	 * Whether or not there are lines left to read.
+	 */
+	bool hasNext();
+
+	/**
+	 * Reads the next line, without its delimiter.
+	 *
+	 * @return The line, or an empty string if there are no lines left.
+	 */
+	std::string next();
+
+	/**
+	 * Closes the file before all the lines are read.
+	 */
+	void close();
+
+	private:
+	/**
+	 * Reads another chunk of the file into the buffer, dropping the lines that were already read.
+	 *
+	 * @return False if the end of the file was reached.
+	 */
+	bool readChunk();
+
+	PHYSFS_File* m_file = NULL;
+	std::string m_delimiter;
+	std::string m_buffer;
+
+	/**
+	 * Where the next line starts in the buffer.
+	 */
+	size_t m_position = 0;
+
+	/**
+	 * Where to look for the next delimiter, past what has already been searched.
+	 */
+	size_t m_searchFrom = 0;
+	bool m_finished = false;
+};
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_FILESYSTEM_LINEITERATOR_H_
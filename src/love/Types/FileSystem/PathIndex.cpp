@@ -0,0 +1,97 @@
+#include "PathIndex.h"
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "physfs.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+const PHYSFS_Stat* PathIndex::stat(const std::string& path) {
+	std::string key(normalize(path));
+	std::unordered_map<std::string, Entry>::iterator found = m_entries.find(key);
+	if (found == m_entries.end()) {
+		Entry entry;
+		entry.found = PHYSFS_stat(key.c_str(), &entry.stat) != 0;
+		if (!entry.found) {
+			// Forget the paths that weren't found once there are too many of them, as the script may look up any number of them.
+			if (m_missing >= MAX_MISSING) {
+				for (std::unordered_map<std::string, Entry>::iterator i = m_entries.begin(); i != m_entries.end();) {
+					i = i->second.found ? std::next(i) : m_entries.erase(i);
+				}
+				m_missing = 0;
+			}
+			m_missing++;
+		}
+		found = m_entries.insert(std::make_pair(key, entry)).first;
+	}
+	return found->second.found ? &found->second.stat : NULL;
+}
+
+const std::vector<std::string>* PathIndex::getDirectoryItems(const std::string& dir) {
+	std::string key(normalize(dir));
+	std::unordered_map<std::string, Directory>::iterator found = m_directories.find(key);
+	if (found == m_directories.end()) {
+		Directory& directory = m_directories[key];
+		directory.found = false;
+		char** files = PHYSFS_enumerateFiles(key.c_str());
+		if (files != NULL) {
+			for (char** i = files; *i != NULL; i++) {
+				directory.items.push_back(std::string(*i));
+			}
+			PHYSFS_freeList(files);
+			directory.found = true;
+		}
+		return directory.found ? &directory.items : NULL;
+	}
+	return found->second.found ? &found->second.items : NULL;
+}
+
+void PathIndex::forget(const std::string& path) {
+	std::string key(normalize(path));
+	m_directories.erase(key);
+
+	// Creating a file or directory may also create the directories leading up to it.
+	while (true) {
+		std::unordered_map<std::string, Entry>::iterator found = m_entries.find(key);
+		if (found != m_entries.end()) {
+			if (!found->second.found) {
+				m_missing--;
+			}
+			m_entries.erase(found);
+		}
+		if (key.empty()) {
+			break;
+		}
+		std::string::size_type slash = key.rfind('/');
+		key = slash == std::string::npos ? std::string() : key.substr(0, slash);
+		m_directories.erase(key);
+	}
+}
+
+void PathIndex::clear() {
+	m_entries.clear();
+	m_directories.clear();
+	m_missing = 0;
+}
+
+std::string PathIndex::normalize(const std::string& path) {
+	std::string output;
+	output.reserve(path.size());
+	for (char c : path) {
+		if (c == '/' && (output.empty() || output.back() == '/')) {
+			continue;
+		}
+		output.push_back(c);
+	}
+	if (!output.empty() && output.back() == '/') {
+		output.pop_back();
+	}
+	return output;
+}
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,76 @@
+#ifndef SRC_LOVE_TYPES_FILESYSTEM_PATHINDEX_H_
+#define SRC_LOVE_TYPES_FILESYSTEM_PATHINDEX_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "physfs.h"
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+/**
+ * Remembers what PhysFS found at each path, so that checking the same path again doesn't walk the whole search path.
+ *
+ * Paths are looked up the first time they're asked for, including paths that don't exist, up to MAX_MISSING of them. The index has to be cleared whenever the search path or the write directory changes, while a write only has to forget the path that was written.
+ *
+ * @see love.filesystem.getInfo
+ */
+class PathIndex {
+	public:
+	/**
+	 * Gets the information about the given path.
+	 *
+	 * @return The stat of the path, or NULL if nothing is there. Valid until the index is next changed.
+	 */
+	const PHYSFS_Stat* stat(const std::string& path);
+
+	/**
+	 * Gets the files and directories in the given directory.
+	 *
+	 * @return The items, or NULL if the directory couldn't be enumerated. Valid until the index is next changed.
+	 */
+	const std::vector<std::string>* getDirectoryItems(const std::string& dir);
+
+	/**
+	 * Forgets the given path, along with the directories leading up to it and their listings, so that they're looked up again after the path is written to or created.
+	 */
+	void forget(const std::string& path);
+
+	/**
+	 * Forgets everything, so that paths are looked up again.
+	 */
+	void clear();
+
+	/**
+	 * The most paths that don't exist to remember, after which they're all forgotten.
+	 */
+	static const size_t MAX_MISSING = 1024;
+
+	private:
+	/**
+	 * Gets the path in the form it's indexed as, without the leading, trailing or repeated slashes that PhysFS ignores.
+	 */
+	static std::string normalize(const std::string& path);
+
+	struct Entry {
+		bool found;
+		PHYSFS_Stat stat;
+	};
+
+	struct Directory {
+		bool found;
+		std::vector<std::string> items;
+	};
+
+	std::unordered_map<std::string, Entry> m_entries;
+	std::unordered_map<std::string, Directory> m_directories;
+	size_t m_missing = 0;
+};
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_FILESYSTEM_PATHINDEX_H_
@@ -0,0 +1,130 @@
+#include "StoredArchive.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+namespace {
+
+const uint32_t ZIP_LOCAL_HEADER = 0x04034b50;
+const uint32_t ZIP_CENTRAL_HEADER = 0x02014b50;
+const uint32_t ZIP_END_OF_CENTRAL_DIRECTORY = 0x06054b50;
+
+uint16_t readUint16(const unsigned char* data) {
+	return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+uint32_t readUint32(const unsigned char* data) {
+	return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+}  // namespace
+
+StoredArchive::StoredArchive(const void* data, size_t size, const std::string& mountpoint) : m_data(static_cast<const unsigned char*>(data)), m_size(size) {
+	if (m_data == NULL || m_size < 22) {
+		return;
+	}
+
+	// The end of central directory record is at the end of the archive, followed by a comment of up to 64KB.
+	size_t end = m_size - 22;
+	size_t searchEnd = end > 0xFFFF ? end - 0xFFFF : 0;
+	bool found = false;
+	while (true) {
+		if (readUint32(m_data + end) == ZIP_END_OF_CENTRAL_DIRECTORY) {
+			found = true;
+			break;
+		}
+		if (end == searchEnd) {
+			break;
+		}
+		end--;
+	}
+	if (!found) {
+		return;
+	}
+
+	uint16_t count = readUint16(m_data + end + 10);
+	uint32_t directorySize = readUint32(m_data + end + 12);
+	uint32_t directoryOffset = readUint32(m_data + end + 16);
+	if (count == 0xFFFF || directoryOffset == 0xFFFFFFFF || static_cast<size_t>(directoryOffset) + directorySize > end) {
+		// ZIP64 archives, or a broken directory.
+		return;
+	}
+
+	std::string prefix = normalize(mountpoint);
+	if (!prefix.empty()) {
+		prefix += "/";
+	}
+
+	size_t position = directoryOffset;
+	for (uint16_t i = 0; i < count; i++) {
+		if (position + 46 > end || readUint32(m_data + position) != ZIP_CENTRAL_HEADER) {
+			return;
+		}
+		const unsigned char* header = m_data + position;
+		uint16_t flags = readUint16(header + 8);
+		uint16_t method = readUint16(header + 10);
+		uint32_t compressedSize = readUint32(header + 20);
+		uint32_t uncompressedSize = readUint32(header + 24);
+		uint16_t nameLength = readUint16(header + 28);
+		uint16_t extraLength = readUint16(header + 30);
+		uint16_t commentLength = readUint16(header + 32);
+		uint32_t localOffset = readUint32(header + 42);
+		if (position + 46 + nameLength > end) {
+			return;
+		}
+		std::string name(reinterpret_cast<const char*>(header + 46), nameLength);
+		position += 46 + nameLength + extraLength + commentLength;
+
+		// Only keep files that are stored as-is.
+		bool encrypted = (flags & 0x1) != 0;
+		if (method != 0 || encrypted || compressedSize != uncompressedSize || name.empty() || name[name.size() - 1] == '/') {
+			continue;
+		}
+
+		// The data follows the local header, which has its own name and extra field lengths.
+		if (static_cast<size_t>(localOffset) + 30 > m_size || readUint32(m_data + localOffset) != ZIP_LOCAL_HEADER) {
+			continue;
+		}
+		size_t dataOffset = static_cast<size_t>(localOffset) + 30 + readUint16(m_data + localOffset + 26) + readUint16(m_data + localOffset + 28);
+		if (dataOffset + uncompressedSize > m_size) {
+			continue;
+		}
+
+		Entry entry;
+		entry.offset = dataOffset;
+		entry.size = uncompressedSize;
+		m_entries[prefix + normalize(name)] = entry;
+	}
+}
+
+bool StoredArchive::find(const std::string& path, const unsigned char** data, size_t* size) const {
+	std::unordered_map<std::string, Entry>::const_iterator found = m_entries.find(normalize(path));
+	if (found == m_entries.end()) {
+		return false;
+	}
+	*data = m_data + found->second.offset;
+	*size = found->second.size;
+	return true;
+}
+
+int StoredArchive::getCount() const {
+	return static_cast<int>(m_entries.size());
+}
+
+std::string StoredArchive::normalize(const std::string& path) {
+	// PhysFS paths don't need a leading slash.
+	size_t start = path.find_first_not_of('/');
+	if (start == std::string::npos) {
+		return "";
+	}
+	return path.substr(start);
+}
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,61 @@
+#ifndef SRC_LOVE_TYPES_FILESYSTEM_STOREDARCHIVE_H_
+#define SRC_LOVE_TYPES_FILESYSTEM_STOREDARCHIVE_H_
+
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+
+namespace love {
+namespace Types {
+namespace FileSystem {
+
+/**
+ * Finds the entries of a zip archive in memory that were stored without compression, so that they can be used straight from the archive's bytes.
+ *
+ * Compressed, encrypted and ZIP64 entries are left out, and are read through PhysFS as usual.
+ */
+class StoredArchive {
+	public:
+	/**
+	 * Indexes the stored entries of the archive.
+	 *
+	 * @param data The bytes of the zip archive, which have to outlive the StoredArchive.
+	 * @param size The size of the archive in bytes.
+	 * @param mountpoint Where the archive is mounted.
+	 */
+	StoredArchive(const void* data, size_t size, const std::string& mountpoint);
+
+	/**
+	 * Finds a stored entry.
+	 *
+	 * @param path The path of the file, including the mountpoint.
+	 * @param data Receives a pointer to the entry's bytes, within the archive.
+	 * @param size Receives the size of the entry.
+	 *
+	 * @return True if the file is stored in the archive.
+	 */
+	bool find(const std::string& path, const unsigned char** data, size_t* size) const;
+
+	/**
+	 * Gets the number of stored entries that were found.
+	 */
+	int getCount() const;
+
+	private:
+	struct Entry {
+		size_t offset;
+		size_t size;
+	};
+
+	static std::string normalize(const std::string& path);
+
+	const unsigned char* m_data;
+	size_t m_size;
+	std::unordered_map<std::string, Entry> m_entries;
+};
+
+}  // namespace FileSystem
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_FILESYSTEM_STOREDARCHIVE_H_
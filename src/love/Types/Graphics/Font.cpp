@@ -30,6 +30,13 @@ Font::Font(const std::string& filename, int ptsize) {
 	font = pntr_load_font_ttf(filename.c_str(), ptsize);
 }
 
+Font::Font(FileData& data, int ptsize) {
+	const unsigned char* buffer = data.getPointer();
+	if (buffer != NULL) {
+		font = pntr_load_font_ttf_from_memory(buffer, static_cast<unsigned int>(data.getSize()), ptsize);
+	}
+}
+
 Font::~Font() {
 	destroy();
 }
@@ -5,6 +5,9 @@
 #include "pntr.h"
 #include <string>
 #include "Image.h"
+#include "../FileSystem/FileData.h"
+
+using love::Types::FileSystem::FileData;
 
 namespace love {
 namespace Types {
@@ -19,6 +22,11 @@ class Font {
 	Font(int size);
 	Font(const std::string& filename, int glyphWidth, int glyphHeight, const std::string& letters);
 	Font(const std::string& filename, int ptsize);
+
+	/**
+	 * Loads a TrueType font from the contents of the given FileData.
+	 */
+	Font(FileData& data, int ptsize);
 	~Font();
 
 	/**
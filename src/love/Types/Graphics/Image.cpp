@@ -19,7 +19,11 @@ bool Image::loaded() {
 }
 
 bool Image::loadFromRW(const unsigned char* data, unsigned int size) {
-	surface = pntr_load_image_from_memory(PNTR_IMAGE_TYPE_PNG, data, size);
+	return loadFromRW(data, size, PNTR_IMAGE_TYPE_PNG);
+}
+
+bool Image::loadFromRW(const unsigned char* data, unsigned int size, pntr_image_type type) {
+	surface = pntr_load_image_from_memory(type, data, size);
 
 	if (!loaded()) {
 		const char* errorChar = pntr_get_error();
@@ -43,13 +47,35 @@ Image::~Image() {
 }
 
 Image::Image(const std::string& filename) {
-	surface = pntr_load_image(filename.c_str());
+	// Decode images stored uncompressed in a memory archive without copying them out first.
+	const unsigned char* view;
+	size_t viewSize;
+	if (ChaiLove::getInstance()->filesystem.getView(filename, &view, &viewSize)) {
+		surface = pntr_load_image_from_memory(pntr_get_file_image_type(filename.c_str()), view, static_cast<unsigned int>(viewSize));
+	} else {
+		surface = pntr_load_image(filename.c_str());
+	}
 
 	if (surface == NULL) {
 		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] Failed to load image: %s", filename.c_str());
 	}
 }
 
+Image::Image(FileData& data) {
+	surface = NULL;
+	const unsigned char* buffer = data.getPointer();
+	if (buffer == NULL) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] Failed to load image: %s", data.getFilename().c_str());
+		return;
+	}
+
+	pntr_image_type type = pntr_get_file_image_type(data.getFilename().c_str());
+	if (type == PNTR_IMAGE_TYPE_UNKNOWN) {
+		type = PNTR_IMAGE_TYPE_PNG;
+	}
+	loadFromRW(buffer, static_cast<unsigned int>(data.getSize()), type);
+}
+
 int Image::getWidth() {
 	if (loaded()) {
 		return surface->width;
@@ -3,6 +3,9 @@
 
 #include "pntr.h"
 #include <string>
+#include "../FileSystem/FileData.h"
+
+using love::Types::FileSystem::FileData;
 
 namespace love {
 namespace Types {
@@ -18,9 +21,15 @@ class Image {
 	pntr_image* surface;
 	Image(const unsigned char* data, unsigned int size);
 	Image(const std::string& filename);
+
+	/**
+	 * Decodes the image straight from the buffer of the given FileData.
+	 */
+	Image(FileData& data);
 	~Image();
 	bool loaded();
 	bool loadFromRW(const unsigned char* data, unsigned int size);
+	bool loadFromRW(const unsigned char* data, unsigned int size, pntr_image_type type);
 	bool destroy();
 
 	/**
@@ -0,0 +1,72 @@
+#include "ButtonState.h"
+#include <algorithm>
+#include <vector>
+
+namespace love {
+namespace Types {
+namespace Input {
+
+void ButtonState::resize(int count) {
+	if (count < 0) {
+		count = 0;
+	}
+	m_count = count;
+	size_t words = (count + 31) / 32;
+	m_current.resize(words, 0);
+	m_previous.resize(words, 0);
+}
+
+void ButtonState::next() {
+	m_previous.swap(m_current);
+	std::fill(m_current.begin(), m_current.end(), 0);
+}
+
+void ButtonState::set(int button, bool down) {
+	if (button < 0 || button >= m_count) {
+		return;
+	}
+	if (down) {
+		m_current[button / 32] |= 1u << (button % 32);
+	} else {
+		m_current[button / 32] &= ~(1u << (button % 32));
+	}
+}
+
+int ButtonState::getCount() {
+	return m_count;
+}
+
+bool ButtonState::getBit(const std::vector<unsigned int>& bits, int button) {
+	if (button < 0 || button >= m_count) {
+		return false;
+	}
+	return (bits[button / 32] >> (button % 32)) & 1;
+}
+
+bool ButtonState::isDown(int button) {
+	return getBit(m_current, button);
+}
+
+bool ButtonState::wasPressed(int button) {
+	return getBit(m_current, button) && !getBit(m_previous, button);
+}
+
+bool ButtonState::wasReleased(int button) {
+	return !getBit(m_current, button) && getBit(m_previous, button);
+}
+
+std::vector<int> ButtonState::pack(const std::vector<unsigned int>& bits) {
+	return std::vector<int>(bits.begin(), bits.end());
+}
+
+std::vector<int> ButtonState::getCurrent() {
+	return pack(m_current);
+}
+
+std::vector<int> ButtonState::getPrevious() {
+	return pack(m_previous);
+}
+
+}  // namespace Input
+}  // namespace Types
+}  // namespace love
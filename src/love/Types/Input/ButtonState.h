@@ -0,0 +1,89 @@
+#ifndef SRC_LOVE_TYPES_INPUT_BUTTONSTATE_H_
+#define SRC_LOVE_TYPES_INPUT_BUTTONSTATE_H_
+
+#include <vector>
+
+namespace love {
+namespace Types {
+namespace Input {
+
+/**
+ * The state of a set of buttons for the current and the previous frame, packed as bits.
+ *
+ * The state is taken once per frame, so checking a button, or whether it was just pressed or released, is a single bit test.
+ *
+ * @code
+ * var keys = love.keyboard.getState()
+ * if (keys.wasPressed(love.keyboard.getScancodeFromKey("space"))) {
+ *   player.jump()
+ * }
+ * @endcode
+ *
+ * @see love.keyboard.getState
+ * @see love.joystick.getState
+ */
+class ButtonState {
+	public:
+	/**
+	 * Sets the number of buttons that the state holds.
+	 */
+	void resize(int count);
+
+	/**
+	 * Starts a new frame, by moving the current state into the previous state.
+	 */
+	void next();
+
+	/**
+	 * Sets whether the given button is down in the current frame.
+	 */
+	void set(int button, bool down);
+
+	/**
+	 * Gets the number of buttons that the state holds.
+	 */
+	int getCount();
+
+	/**
+	 * Checks whether the given button is down in the current frame.
+	 */
+	bool isDown(int button);
+
+	/**
+	 * Checks whether the given button went down since the previous frame.
+	 */
+	bool wasPressed(int button);
+
+	/**
+	 * Checks whether the given button went up since the previous frame.
+	 */
+	bool wasReleased(int button);
+
+	/**
+	 * Gets the state of the current frame, packed as 32 buttons per integer.
+	 *
+	 * Button n is bit (n % 32) of integer (n / 32).
+	 */
+	std::vector<int> getCurrent();
+
+	/**
+	 * Gets the state of the previous frame, packed as 32 buttons per integer.
+	 *
+	 * @see getCurrent
+	 */
+	std::vector<int> getPrevious();
+
+	private:
+	bool getBit(const std::vector<unsigned int>& bits, int button);
+	std::vector<int> pack(const std::vector<unsigned int>& bits);
+
+	std::vector<unsigned int> m_current;
+	std::vector<unsigned int> m_previous;
+	int m_count = 0;
+};
+
+}  // namespace Input
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_INPUT_BUTTONSTATE_H_
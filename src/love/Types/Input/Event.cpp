@@ -0,0 +1,11 @@
+#include "Event.h"
+
+namespace love {
+namespace Types {
+namespace Input {
+
+// Nothing.
+
+}  // namespace Input
+}  // namespace Types
+}  // namespace love
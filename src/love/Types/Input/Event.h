@@ -0,0 +1,73 @@
+#ifndef SRC_LOVE_TYPES_INPUT_EVENT_H_
+#define SRC_LOVE_TYPES_INPUT_EVENT_H_
+
+namespace love {
+namespace Types {
+namespace Input {
+
+/**
+ * An input event, as delivered in a batch to the events(list) callback.
+ *
+ * @see love::script::events
+ */
+struct Event {
+	/**
+	 * The types of event, available to the script as love.event.KEYPRESSED, love.event.MOUSEMOVED, and so on.
+	 */
+	enum Type {
+		KEYPRESSED,
+		KEYRELEASED,
+		MOUSEPRESSED,
+		MOUSERELEASED,
+		MOUSEMOVED,
+		WHEELMOVED,
+		GAMEPADPRESSED,
+		GAMEPADRELEASED
+	};
+
+	/**
+	 * The type of the event, compared against the love.event constants, like love.event.KEYPRESSED.
+	 */
+	int type = KEYPRESSED;
+
+	/**
+	 * The mouse position on the x-axis, or the wheel movement, as given to wheelmoved(x, y).
+	 */
+	int x = 0;
+
+	/**
+	 * The mouse position on the y-axis. Always 0 for wheel movement, as pntr only reports a single wheel axis.
+	 */
+	int y = 0;
+
+	/**
+	 * The amount the mouse moved along the x-axis, summed over all the movement since the last frame.
+	 */
+	int dx = 0;
+
+	/**
+	 * The amount the mouse moved along the y-axis, summed over all the movement since the last frame.
+	 */
+	int dy = 0;
+
+	/**
+	 * The mouse or gamepad button.
+	 */
+	int button = 0;
+
+	/**
+	 * The scancode of the key. Use love.keyboard.getKeyFromScancode() to get its name.
+	 */
+	int key = 0;
+
+	/**
+	 * The index of the joystick of a gamepad event.
+	 */
+	int joystick = 0;
+};
+
+}  // namespace Input
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_INPUT_EVENT_H_
@@ -11,9 +11,14 @@ Joystick::Joystick() {
 }
 
 Joystick::Joystick(pntr_app* app, int i) : m_index(i), m_app(app) {
+	m_state.resize(PNTR_APP_GAMEPAD_BUTTON_LAST);
 }
 
 bool Joystick::isDown(int button) {
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->replay.isPlaying()) {
+		return app->replay.isGamepadButtonDown(m_index, button);
+	}
 	return pntr_app_gamepad_button_down(m_app, m_index, (pntr_app_gamepad_button)button);
 }
 
@@ -22,6 +27,35 @@ bool Joystick::isDown(const std::string& button) {
 	return isDown(key);
 }
 
+bool Joystick::wasPressed(int button) {
+	return m_state.wasPressed(button);
+}
+
+bool Joystick::wasPressed(const std::string& button) {
+	return wasPressed(ChaiLove::getInstance()->joystick.getButtonKey(button));
+}
+
+bool Joystick::wasReleased(int button) {
+	return m_state.wasReleased(button);
+}
+
+bool Joystick::wasReleased(const std::string& button) {
+	return wasReleased(ChaiLove::getInstance()->joystick.getButtonKey(button));
+}
+
+ButtonState& Joystick::getState() {
+	return m_state;
+}
+
+void Joystick::update() {
+	m_state.next();
+	for (int button = PNTR_APP_GAMEPAD_BUTTON_FIRST; button < PNTR_APP_GAMEPAD_BUTTON_LAST; button++) {
+		if (isDown(button)) {
+			m_state.set(button, true);
+		}
+	}
+}
+
 bool Joystick::isConnected() {
 	return m_connected;
 }
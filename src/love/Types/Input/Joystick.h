@@ -4,6 +4,7 @@
 #include <string>
 
 #include "pntr_app.h"
+#include "ButtonState.h"
 
 namespace love {
 namespace Types {
@@ -44,6 +45,38 @@ class Joystick {
 	 */
 	bool isDown(const std::string& button);
 
+	/**
+	 * Checks if a button on the Joystick went down since the previous frame.
+	 *
+	 * @param button The button to be checked
+	 *
+	 * @return bool Whether or not the given button was just pressed.
+	 */
+	bool wasPressed(int button);
+	bool wasPressed(const std::string& button);
+
+	/**
+	 * Checks if a button on the Joystick went up since the previous frame.
+	 *
+	 * @param button The button to be checked
+	 *
+	 * @return bool Whether or not the given button was just released.
+	 */
+	bool wasReleased(int button);
+	bool wasReleased(const std::string& button);
+
+	/**
+	 * Gets the state of all buttons for the current and the previous frame.
+	 *
+	 * @return The state of the Joystick buttons.
+	 */
+	ButtonState& getState();
+
+	/**
+	 * Takes the state of all buttons for the current frame.
+	 */
+	void update();
+
 	/**
 	 * Gets whether the Joystick is connected.
 	 *
@@ -61,6 +94,7 @@ class Joystick {
 	private:
 	int m_index = 0;
 	bool m_connected = true;
+	ButtonState m_state;
 };
 
 }  // namespace Input
@@ -0,0 +1,157 @@
+#include "Vector2.h"
+
+#include <cmath>
+#include <sstream>
+
+namespace love {
+namespace Types {
+namespace Math {
+
+Vector2::Vector2() : x(0.0f), y(0.0f) {
+	// Nothing.
+}
+
+Vector2::Vector2(float value) : x(value), y(value) {
+	// Nothing.
+}
+
+Vector2::Vector2(float t_x, float t_y) : x(t_x), y(t_y) {
+	// Nothing.
+}
+
+Vector2 Vector2::operator+(const Vector2& other) const {
+	return Vector2(x + other.x, y + other.y);
+}
+
+Vector2 Vector2::operator-(const Vector2& other) const {
+	return Vector2(x - other.x, y - other.y);
+}
+
+Vector2 Vector2::operator-() const {
+	return Vector2(-x, -y);
+}
+
+Vector2 Vector2::operator*(const Vector2& other) const {
+	return Vector2(x * other.x, y * other.y);
+}
+
+Vector2 Vector2::operator*(float scalar) const {
+	return Vector2(x * scalar, y * scalar);
+}
+
+Vector2 Vector2::operator/(const Vector2& other) const {
+	return Vector2(x / other.x, y / other.y);
+}
+
+Vector2 Vector2::operator/(float scalar) const {
+	return Vector2(x / scalar, y / scalar);
+}
+
+Vector2& Vector2::operator+=(const Vector2& other) {
+	x += other.x;
+	y += other.y;
+	return *this;
+}
+
+Vector2& Vector2::operator-=(const Vector2& other) {
+	x -= other.x;
+	y -= other.y;
+	return *this;
+}
+
+Vector2& Vector2::operator*=(float scalar) {
+	x *= scalar;
+	y *= scalar;
+	return *this;
+}
+
+Vector2& Vector2::operator/=(float scalar) {
+	x /= scalar;
+	y /= scalar;
+	return *this;
+}
+
+bool Vector2::operator==(const Vector2& other) const {
+	return x == other.x && y == other.y;
+}
+
+bool Vector2::operator!=(const Vector2& other) const {
+	return !(*this == other);
+}
+
+Vector2& Vector2::set(float t_x, float t_y) {
+	x = t_x;
+	y = t_y;
+	return *this;
+}
+
+float Vector2::dot(const Vector2& other) const {
+	return x * other.x + y * other.y;
+}
+
+float Vector2::cross(const Vector2& other) const {
+	return x * other.y - y * other.x;
+}
+
+float Vector2::length() const {
+	return std::sqrt(lengthSquared());
+}
+
+float Vector2::lengthSquared() const {
+	return x * x + y * y;
+}
+
+float Vector2::distance(const Vector2& other) const {
+	return (*this - other).length();
+}
+
+float Vector2::angle() const {
+	return std::atan2(y, x);
+}
+
+Vector2 Vector2::normalized() const {
+	Vector2 output(*this);
+	return output.normalizeInplace();
+}
+
+Vector2& Vector2::normalizeInplace() {
+	float len = length();
+	if (len > 0.0f) {
+		x /= len;
+		y /= len;
+	}
+	return *this;
+}
+
+Vector2 Vector2::rotated(float angle) const {
+	Vector2 output(*this);
+	return output.rotateInplace(angle);
+}
+
+Vector2& Vector2::rotateInplace(float angle) {
+	float c = std::cos(angle);
+	float s = std::sin(angle);
+	return set(x * c - y * s, x * s + y * c);
+}
+
+Vector2 Vector2::lerp(const Vector2& other, float t) const {
+	return Vector2(x + (other.x - x) * t, y + (other.y - y) * t);
+}
+
+Vector2& Vector2::lerpInplace(const Vector2& other, float t) {
+	return set(x + (other.x - x) * t, y + (other.y - y) * t);
+}
+
+std::string Vector2::toString() const {
+	std::stringstream output;
+	output << "(" << x << ", " << y << ")";
+	return output.str();
+}
+
+Vector2 operator*(float scalar, const Vector2& vector) {
+	return vector * scalar;
+}
+
+}  // namespace Math
+}  // namespace Types
+}  // namespace love
@@ -0,0 +1,157 @@
+#ifndef SRC_LOVE_TYPES_MATH_VECTOR2_H_
+#define SRC_LOVE_TYPES_MATH_VECTOR2_H_
+
+#include <string>
+
+namespace love {
+namespace Types {
+namespace Math {
+
+/**
+ * A two dimensional vector, with its math done natively rather than through script numbers.
+ *
+ * @code
+ * global position = Vector2(100, 100)
+ * global velocity = Vector2(20, 0)
+ *
+ * def update(dt) {
+ *   position += velocity * dt
+ *   velocity.rotateInplace(dt)
+ * }
+ *
+ * def draw() {
+ *   love.graphics.draw(image, position)
+ * }
+ * @endcode
+ */
+class Vector2 {
+	public:
+	Vector2();
+	Vector2(float value);
+	Vector2(float x, float y);
+
+	/**
+	 * The x component.
+	 */
+	float x;
+
+	/**
+	 * The y component.
+	 */
+	float y;
+
+	Vector2 operator+(const Vector2& other) const;
+	Vector2 operator-(const Vector2& other) const;
+	Vector2 operator-() const;
+	Vector2 operator*(const Vector2& other) const;
+	Vector2 operator*(float scalar) const;
+	Vector2 operator/(const Vector2& other) const;
+	Vector2 operator/(float scalar) const;
+	Vector2& operator+=(const Vector2& other);
+	Vector2& operator-=(const Vector2& other);
+	Vector2& operator*=(float scalar);
+	Vector2& operator/=(float scalar);
+	bool operator==(const Vector2& other) const;
+	bool operator!=(const Vector2& other) const;
+
+	/**
+	 * Sets both components of the vector.
+	 *
+	 * @return The vector, to allow for method chaining.
+	 */
+	Vector2& set(float x, float y);
+
+	/**
+	 * Gets the dot product of this and the given vector.
+	 */
+	float dot(const Vector2& other) const;
+
+	/**
+	 * Gets the z component of the cross product of this and the given vector.
+	 */
+	float cross(const Vector2& other) const;
+
+	/**
+	 * Gets the length of the vector.
+	 */
+	float length() const;
+
+	/**
+	 * Gets the squared length of the vector, which avoids the square root when comparing lengths.
+	 */
+	float lengthSquared() const;
+
+	/**
+	 * Gets the distance between this and the given vector.
+	 */
+	float distance(const Vector2& other) const;
+
+	/**
+	 * Gets the angle of the vector, in radians.
+	 */
+	float angle() const;
+
+	/**
+	 * Gets a vector with the same direction, and a length of 1.
+	 *
+	 * A zero length vector stays as zero.
+	 *
+	 * @see normalizeInplace
+	 */
+	Vector2 normalized() const;
+
+	/**
+	 * Normalizes the vector to a length of 1.
+	 *
+	 * @return The vector, to allow for method chaining.
+	 */
+	Vector2& normalizeInplace();
+
+	/**
+	 * Gets the vector rotated by the given angle.
+	 *
+	 * @param angle The angle to rotate by, in radians.
+	 *
+	 * @see rotateInplace
+	 */
+	Vector2 rotated(float angle) const;
+
+	/**
+	 * Rotates the vector by the given angle.
+	 *
+	 * @param angle The angle to rotate by, in radians.
+	 *
+	 * @return The vector, to allow for method chaining.
+	 */
+	Vector2& rotateInplace(float angle);
+
+	/**
+	 * Gets the linear interpolation between this and the given vector.
+	 *
+	 * @param other The vector to interpolate towards.
+	 * @param t The amount to interpolate, where 0 is this vector and 1 is the other vector.
+	 *
+	 * @see lerpInplace
+	 */
+	Vector2 lerp(const Vector2& other, float t) const;
+
+	/**
+	 * Moves the vector towards the given vector, by linear interpolation.
+	 *
+	 * @return The vector, to allow for method chaining.
+	 */
+	Vector2& lerpInplace(const Vector2& other, float t);
+
+	/**
+	 * Gets a string representation of the vector, like "(10, 20)".
+	 */
+	std::string toString() const;
+};
+
+Vector2 operator*(float scalar, const Vector2& vector);
+
+}  // namespace Math
+}  // namespace Types
+}  // namespace love
+
+#endif  // SRC_LOVE_TYPES_MATH_VECTOR2_H_
@@ -26,6 +26,16 @@ SoundData* audio::newSource(const std::string& filename) {
 	return NULL;
 }
 
+SoundData* audio::newSource(FileData& data) {
+	SoundData* newSound = new SoundData(data);
+	if (newSound->isLoaded()) {
+		ChaiLove::getInstance()->sound.sounds.push_back(newSound);
+		return newSound;
+	}
+	delete newSound;
+	return NULL;
+}
+
 SoundData* audio::newSource(const std::string& filename, const std::string& type) {
 	return newSource(filename);
 }
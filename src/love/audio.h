@@ -2,9 +2,11 @@
 #define SRC_LOVE_AUDIO_H_
 
 #include "Types/Audio/SoundData.h"
+#include "Types/FileSystem/FileData.h"
 #include "sound.h"
 
 using love::Types::Audio::SoundData;
+using love::Types::FileSystem::FileData;
 
 namespace love {
 
@@ -37,6 +39,11 @@ class audio {
 	SoundData* newSource(const std::string& filename, const std::string& type);
 	SoundData* newSource(const std::string& filename);
 
+	/**
+	 * Creates a new audio source from the contents of a FileData.
+	 */
+	SoundData* newSource(FileData& data);
+
 	/**
 	 * Returns the master volume.
 	 *
@@ -6,6 +6,8 @@ namespace love {
 config::config() {
 	options["alphablending"] = true;
 	options["highquality"] = true;
+	options["savestatedelta"] = false;
+	options["savestatecompress"] = false;
 	version = CHAILOVE_VERSION_STRING;
 	console = false;
 }
@@ -82,10 +82,27 @@ class config {
 	 * @code
 	 * t.options["alphablending"] = true
 	 * t.options["highquality"] = true
+	 * t.options["savestatedelta"] = false
+	 * t.options["savestatecompress"] = false
 	 * @endcode
+	 *
+	 * @see love.data.getSavestateStats
 	 */
 	std::map<std::string, bool> options;
 
+	/**
+	 * The size of the largest savestate the game will need, in bytes.
+	 *
+	 * The frontend asks for the size of a savestate once, before it makes the first one. Without this, that's twice the size of the state at the time. Set it when the state can grow past that, like when more entities are spawned, so that saving doesn't start to fail.
+	 *
+	 * ## Example
+	 *
+	 * @code
+	 * t.savestateSize = 256 * 1024
+	 * @endcode
+	 */
+	int savestateSize = 0;
+
 	bool console = false;
 };
 
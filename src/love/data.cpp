@@ -2,90 +2,229 @@
 #include <cstdlib>
 #include <ctime>
 #include <cstring>
+#include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <sstream>
 #include <vector>
 #include "compat/zlib.h"
-#include "utils/md5.h"
-#include "TinySHA1.hpp"
-#include <cppcodec/base64_default_rfc4648.hpp>
-#include <cppcodec/hex_default_lower.hpp>
 #include "pntr_app.h"
+#include "Types/Data/LZ4.h"
+#include "Types/Data/Compressor.h"
+#include "Types/Data/Hasher.h"
+#include "Types/Data/Base64.h"
+#include "Types/Data/Hex.h"
+
+using love::Types::Data::LZ4;
+using love::Types::Data::Hasher;
+using love::Types::Data::Base64;
+using love::Types::Data::Hex;
 
 namespace love {
 
+StructType* data::newStruct(const std::string& name, const std::vector<std::string>& fields) {
+	// Declaring the same record type again reuses the existing one.
+	for (StructType* existing : m_structs) {
+		if (existing->getName() == name) {
+			if (existing->getFields() == fields) {
+				return existing;
+			}
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Struct %s is already declared with different fields.", name.c_str());
+			return NULL;
+		}
+	}
+
+	StructType* type = new StructType(name, fields);
+	if (!type->isValid()) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Struct %s has invalid fields.", name.c_str());
+		delete type;
+		return NULL;
+	}
+	m_structs.push_back(type);
+	return type;
+}
+
+std::shared_ptr<Compressor> data::newCompressor(const std::string& format, int level) {
+	return newStream(format, level, false);
+}
+
+std::shared_ptr<Compressor> data::newCompressor(const std::string& format) {
+	return newCompressor(format, -1);
+}
+
+std::shared_ptr<Compressor> data::newDecompressor(const std::string& format) {
+	return newStream(format, -1, true);
+}
+
+std::shared_ptr<Compressor> data::newStream(const std::string& format, int level, bool decompress) {
+	std::shared_ptr<Compressor> stream(new Compressor(format, level, decompress));
+	if (!stream->isValid()) {
+		return std::shared_ptr<Compressor>();
+	}
+	return stream;
+}
+
+bool data::unload() {
+	for (StructType* type : m_structs) {
+		delete type;
+	}
+	m_structs.clear();
+	return true;
+}
+
+ByteData data::newByteData(int size) {
+	ByteData output;
+	output.resize(size);
+	return output;
+}
+
+ByteData data::newByteData(const std::string& contents) {
+	return ByteData(contents);
+}
+
+std::map<std::string, int> data::getSavestateStats() {
+	return m_savestates.getStats();
+}
+
+SavestateEncoder& data::getSavestateEncoder() {
+	return m_savestates;
+}
+
 std::string data::compress(const std::string& str) {
-	return compress(str, Z_BEST_SPEED);
+	return compress("zlib", str, Z_BEST_SPEED);
 }
 
 std::string data::compress(const std::string& str, int compressionlevel) {
+	return compress("zlib", str, compressionlevel);
+}
+
+std::string data::compress(const std::string& format, const std::string& str) {
+	return compress(format, str, Z_BEST_SPEED);
+}
+
+std::string data::compress(const std::string& format, const std::string& str, int compressionlevel) {
+	return compress(format, reinterpret_cast<const uint8_t*>(str.data()), str.size(), compressionlevel);
+}
+
+std::string data::compress(const std::string& format, ByteData& input, int compressionlevel) {
+	return compress(format, input.getPointer(), input.getSize(), compressionlevel);
+}
+
+std::string data::compress(const std::string& format, ByteData& input) {
+	return compress(format, input, Z_BEST_SPEED);
+}
+
+std::string data::compress(const std::string& format, const uint8_t* input, size_t inputSize, int compressionlevel) {
+	if (format == "lz4") {
+		// Store the uncompressed size first, as the block doesn't hold it.
+		uint32_t size = static_cast<uint32_t>(inputSize);
+		std::string outstring;
+		outstring.resize(sizeof(size) + LZ4::compressBound(inputSize));
+		memcpy(&outstring[0], &size, sizeof(size));
+		size_t compressedSize = LZ4::compress(input, inputSize, reinterpret_cast<uint8_t*>(&outstring[sizeof(size)]));
+		outstring.resize(sizeof(size) + compressedSize);
+		return outstring;
+	}
+
+	int windowBits = Compressor::getWindowBits(format);
+	if (windowBits == 0) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Unknown compression format %s.", format.c_str());
+		return std::string(reinterpret_cast<const char*>(input), inputSize);
+	}
 	if (compressionlevel < 0 || compressionlevel > 9) {
 		compressionlevel = Z_BEST_SPEED;
 	}
 	z_stream zs;
 	memset(&zs, 0, sizeof(zs));
 
-	if (deflateInit(&zs, compressionlevel) != Z_OK) {
+	if (deflateInit2(&zs, compressionlevel, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
 		pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] deflateInit failed while compressing.");
-		return str;
+		return std::string(reinterpret_cast<const char*>(input), inputSize);
 	}
 
-	zs.next_in = (Bytef*)str.data();
-	zs.avail_in = str.size();
-
-	int ret;
-	char outbuffer[32768];
+	// Compress in a single pass, into output that is sized for the worst case.
 	std::string outstring;
-
-	do {
-		zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-		zs.avail_out = sizeof(outbuffer);
-
-		ret = deflate(&zs, Z_FINISH);
-
-		if (outstring.size() < zs.total_out) {
-			outstring.append(outbuffer,
-							 zs.total_out - outstring.size());
-		}
-	} while (ret == Z_OK);
-
+	outstring.resize(deflateBound(&zs, inputSize));
+	zs.next_in = (Bytef*)input;
+	zs.avail_in = inputSize;
+	zs.next_out = reinterpret_cast<Bytef*>(&outstring[0]);
+	zs.avail_out = outstring.size();
+
+	int ret = deflate(&zs, Z_FINISH);
+	outstring.resize(zs.total_out);
 	deflateEnd(&zs);
 
 	if (ret != Z_STREAM_END) {
-		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] deflateInit failed: %s", zs.msg);
-		return str;
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] deflate failed: %s", zs.msg);
+		return std::string(reinterpret_cast<const char*>(input), inputSize);
 	}
 
 	return outstring;
 }
 
 std::string data::decompress(const std::string& str) {
+	return decompress("zlib", str);
+}
+
+std::string data::decompress(const std::string& format, const std::string& str) {
+	return decompress(format, reinterpret_cast<const uint8_t*>(str.data()), str.size());
+}
+
+std::string data::decompress(const std::string& format, ByteData& input) {
+	return decompress(format, input.getPointer(), input.getSize());
+}
+
+std::string data::decompress(const std::string& format, const uint8_t* input, size_t inputSize) {
+	if (format == "lz4") {
+		uint32_t size;
+		if (inputSize < sizeof(size)) {
+			throw(std::runtime_error("[ChaiLove] [data] LZ4 data is too short."));
+		}
+		memcpy(&size, input, sizeof(size));
+		if (size > LZ4::decompressBound(inputSize - sizeof(size))) {
+			throw(std::runtime_error("[ChaiLove] [data] LZ4 data claims a larger size than it can hold."));
+		}
+		std::string outstring;
+		outstring.resize(size);
+		if (!LZ4::decompress(input + sizeof(size), inputSize - sizeof(size), reinterpret_cast<uint8_t*>(&outstring[0]), size)) {
+			throw(std::runtime_error("[ChaiLove] [data] Exception during LZ4 decompression."));
+		}
+		return outstring;
+	}
+
+	int windowBits = Compressor::getWindowBits(format);
+	if (windowBits == 0) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Unknown compression format %s.", format.c_str());
+		return std::string(reinterpret_cast<const char*>(input), inputSize);
+	}
+
 	z_stream zs;
 	memset(&zs, 0, sizeof(zs));
 
-	if (inflateInit(&zs) != Z_OK)
+	if (inflateInit2(&zs, windowBits) != Z_OK)
 		throw(std::runtime_error("inflateInit failed while decompressing."));
 
-	zs.next_in = (Bytef*)str.data();
-	zs.avail_in = str.size();
+	zs.next_in = (Bytef*)input;
+	zs.avail_in = inputSize;
 
+	// Inflate straight into the output, doubling it whenever it fills up.
 	int ret;
-	char outbuffer[32768];
 	std::string outstring;
+	outstring.resize(inputSize * 4 > 1024 ? inputSize * 4 : 1024);
 
 	do {
-		zs.next_out = reinterpret_cast<Bytef*>(outbuffer);
-		zs.avail_out = sizeof(outbuffer);
-
-		ret = inflate(&zs, 0);
-
-		if (outstring.size() < zs.total_out) {
-			outstring.append(outbuffer,
-							 zs.total_out - outstring.size());
+		if (zs.total_out >= outstring.size()) {
+			outstring.resize(outstring.size() * 2);
 		}
+		zs.next_out = reinterpret_cast<Bytef*>(&outstring[zs.total_out]);
+		zs.avail_out = outstring.size() - zs.total_out;
+
+		ret = inflate(&zs, Z_NO_FLUSH);
 	} while (ret == Z_OK);
 
+	outstring.resize(zs.total_out);
 	inflateEnd(&zs);
 
 	if (ret != Z_STREAM_END) {
@@ -98,30 +237,48 @@ std::string data::decompress(const std::string& str) {
 }
 
 std::string data::encode(const std::string& containerType, const std::string& format, const std::string& sourceString) {
+	return encode(format, reinterpret_cast<const uint8_t*>(sourceString.data()), sourceString.size());
+}
+
+std::string data::encode(const std::string& containerType, const std::string& format, ByteData& source) {
+	return encode(format, source.getPointer(), source.getSize());
+}
+
+std::string data::encode(const std::string& format, const uint8_t* source, size_t sourceSize) {
 	if (format == "base64") {
-		std::string encoded = base64::encode(sourceString);
+		std::string encoded(Base64::getEncodedSize(sourceSize), '\0');
+		Base64::encode(source, sourceSize, &encoded[0]);
 		return encoded;
 	}
 
 	if (format == "hex") {
-		std::string encoded = hex::encode(sourceString);
+		std::string encoded(sourceSize * 2, '\0');
+		Hex::encode(source, sourceSize, &encoded[0]);
 		return encoded;
 	}
 
 	pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove]Warning: love.data.encode format not found: %s", format.c_str());
-	return sourceString;
+	return std::string(reinterpret_cast<const char*>(source), sourceSize);
 }
 
 std::string data::decode(const std::string& containerType, const std::string& format, const std::string& sourceString) {
 	if (format == "base64") {
-		std::vector<unsigned char> decodedVector = base64::decode(sourceString);
-		std::string decoded(decodedVector.begin(), decodedVector.end());
+		std::string decoded(Base64::getDecodedSize(sourceString.size()), '\0');
+		size_t decodedSize = 0;
+		if (!Base64::decode(sourceString.data(), sourceString.size(), reinterpret_cast<uint8_t*>(&decoded[0]), &decodedSize)) {
+			pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] love.data.decode was given invalid base64.");
+			return "";
+		}
+		decoded.resize(decodedSize);
 		return decoded;
 	}
 
 	if (format == "hex") {
-		std::vector<unsigned char> decodedVector = hex::decode(sourceString);
-		std::string decoded(decodedVector.begin(), decodedVector.end());
+		std::string decoded(sourceString.size() / 2, '\0');
+		if (!Hex::decode(sourceString.data(), sourceString.size(), reinterpret_cast<uint8_t*>(&decoded[0]))) {
+			pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] love.data.decode was given invalid hex.");
+			return "";
+		}
 		return decoded;
 	}
 
@@ -130,55 +287,692 @@ std::string data::decode(const std::string& containerType, const std::string& fo
 }
 
 std::string data::hash(const std::string& hashFunction, const std::string& data) {
-	if (hashFunction == "md5") {
-		return hash_md5(data);
+	return hash(hashFunction, reinterpret_cast<const uint8_t*>(data.data()), data.size());
+}
+
+std::string data::hash(const std::string& hashFunction, ByteData& data) {
+	return hash(hashFunction, data.getPointer(), data.getSize());
+}
+
+std::string data::hash(const std::string& hashFunction, const uint8_t* data, size_t size) {
+	Hasher hasher(hashFunction);
+	if (!hasher.isValid()) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] Error: Hash function not found: %s", hashFunction.c_str());
+		return "";
+	}
+	return hasher.update(data, size).finish();
+}
+
+#ifdef __HAVE_CHAISCRIPT__
+namespace {
+
+/**
+ * The type of each value in the serialized data.
+ */
+enum SerializeTag {
+	SERIALIZE_UNDEFINED = 0,
+	SERIALIZE_FALSE,
+	SERIALIZE_TRUE,
+	SERIALIZE_INT,
+	SERIALIZE_LONG,
+	SERIALIZE_FLOAT,
+	SERIALIZE_DOUBLE,
+	SERIALIZE_STRING,
+	SERIALIZE_STRINGREF,
+	SERIALIZE_VECTOR,
+	SERIALIZE_MAP,
+	SERIALIZE_LIST,
+	SERIALIZE_VECTORINT,
+	SERIALIZE_VECTORFLOAT,
+	SERIALIZE_STRINGVECTOR,
+	SERIALIZE_STRINGBOOLMAP,
+	SERIALIZE_STRINGINTMAP,
+	SERIALIZE_STRINGFLOATMAP
+};
+
+const int SERIALIZE_VERSION = 1;
+const int SERIALIZE_MAX_DEPTH = 64;
+
+/**
+ * Writes an unsigned integer using 7 bits per byte, so that small counts and lengths take a single byte.
+ */
+void writeVarint(ByteData& output, uint32_t value) {
+	uint8_t bytes[5];
+	size_t size = 0;
+	while (value >= 0x80) {
+		bytes[size++] = static_cast<uint8_t>(value | 0x80);
+		value >>= 7;
 	}
+	bytes[size++] = static_cast<uint8_t>(value);
+	output.write(bytes, size);
+}
 
-	if (hashFunction == "sha1") {
-		return hash_sha1(data);
+bool readVarint(ByteData& input, uint32_t* value) {
+	*value = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		uint8_t byte;
+		if (!input.read(&byte, 1)) {
+			return false;
+		}
+		*value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
 	}
+	return false;
+}
+
+/**
+ * Reads the number of elements of a container, making sure that the data could hold that many.
+ */
+bool readCount(ByteData& input, uint32_t* count) {
+	return readVarint(input, count) && *count <= static_cast<uint32_t>(input.getSize() - input.tell());
+}
 
-	pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] Error: Hash function not found: %s", hashFunction.c_str());
-	return "";
+void writeTag(ByteData& output, SerializeTag tag) {
+	output.writeByte(tag);
 }
 
-std::string data::hash_md5(const std::string& data) {
-	const char* input = data.c_str();
-	unsigned char digest[16];
+}  // namespace
+
+std::string data::serialize(const chaiscript::Boxed_Value& value) {
+	ByteData output;
+	serialize(value, output);
+	return output.getString();
+}
+
+bool data::serialize(const chaiscript::Boxed_Value& value, ByteData& output) {
+	SerializeStrings strings;
+	output.writeByte(SERIALIZE_VERSION);
+	return writeValue(value, output, strings, 0);
+}
+
+chaiscript::Boxed_Value data::deserialize(const std::string& input) {
+	ByteData data;
+	data.wrap(input.data(), input.size());
+	return deserialize(data);
+}
+
+chaiscript::Boxed_Value data::deserialize(ByteData& input) {
+	int version = input.readByte();
+	if (version != SERIALIZE_VERSION) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Unknown serialized data version %d.", version);
+		return chaiscript::Boxed_Value();
+	}
+	SerializeStrings strings;
+	return readValue(input, strings, 0);
+}
+
+void data::writeString(const std::string& value, ByteData& output, SerializeStrings& strings) {
+	std::map<std::string, unsigned int>::iterator found = strings.written.find(value);
+	if (found != strings.written.end()) {
+		writeTag(output, SERIALIZE_STRINGREF);
+		writeVarint(output, found->second);
+		return;
+	}
+	unsigned int index = static_cast<unsigned int>(strings.written.size());
+	strings.written.insert(std::pair<std::string, unsigned int>(value, index));
+	writeTag(output, SERIALIZE_STRING);
+	writeVarint(output, static_cast<uint32_t>(value.size()));
+	output.write(value.data(), value.size());
+}
 
-	// Calculate the MD5 hash using libretro-common.
-	MD5_CTX context;
-	MD5_Init(&context);
-	MD5_Update(&context, input, strlen(input));
-	MD5_Final(digest, &context);
+bool data::writeValue(const chaiscript::Boxed_Value& value, ByteData& output, SerializeStrings& strings, int depth) {
+	using chaiscript::Boxed_Value;
+	using chaiscript::boxed_cast;
+	using chaiscript::user_type;
 
-	// Construct the MD5 hash string.
-	char md5string[33+8];
-	for (int i = 0; i < 16; ++i) {
-		/*
-		  sizeof(&md5string[i * 2]) is a sizeof of a pointer, so 4 or 8
-		  instead of intended 3 (2 hex digits + \0) leading
-		  to a potential overflow
-		*/
-		snprintf(&md5string[i * 2], 3, "%02x", (unsigned int)digest[i]); /* NOLINT(runtime/printf).  */
+	if (depth > SERIALIZE_MAX_DEPTH) {
+		pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Value is nested too deeply to serialize.");
+		writeTag(output, SERIALIZE_UNDEFINED);
+		return false;
+	}
+
+	if (value.is_undef() || value.is_null()) {
+		writeTag(output, SERIALIZE_UNDEFINED);
+		return true;
+	}
+
+	// Booleans and numbers.
+	if (value.is_type(user_type<bool>())) {
+		writeTag(output, boxed_cast<bool>(value) ? SERIALIZE_TRUE : SERIALIZE_FALSE);
+		return true;
+	}
+	if (value.is_type(user_type<int>())) {
+		writeTag(output, SERIALIZE_INT);
+		output.writeInt(boxed_cast<int>(value));
+		return true;
+	}
+	if (value.is_type(user_type<float>())) {
+		writeTag(output, SERIALIZE_FLOAT);
+		output.writeFloat(boxed_cast<float>(value));
+		return true;
+	}
+	if (value.get_type_info().is_arithmetic()) {
+		chaiscript::Boxed_Number number(value);
+		if (value.is_type(user_type<double>()) || value.is_type(user_type<long double>())) {
+			writeTag(output, SERIALIZE_DOUBLE);
+			output.writeDouble(number.get_as<double>());
+		} else {
+			int64_t integer = number.get_as<int64_t>();
+			writeTag(output, SERIALIZE_LONG);
+			output.write(&integer, sizeof(integer));
+		}
+		return true;
+	}
+
+	if (value.is_type(user_type<std::string>())) {
+		writeString(boxed_cast<const std::string&>(value), output, strings);
+		return true;
+	}
+
+	// Script containers.
+	bool result = true;
+	if (value.is_type(user_type<std::vector<Boxed_Value> >())) {
+		const std::vector<Boxed_Value>& vector = boxed_cast<const std::vector<Boxed_Value>&>(value);
+		writeTag(output, SERIALIZE_VECTOR);
+		writeVarint(output, static_cast<uint32_t>(vector.size()));
+		for (const Boxed_Value& element : vector) {
+			result = writeValue(element, output, strings, depth + 1) && result;
+		}
+		return result;
+	}
+	if (value.is_type(user_type<std::map<std::string, Boxed_Value> >())) {
+		const std::map<std::string, Boxed_Value>& map = boxed_cast<const std::map<std::string, Boxed_Value>&>(value);
+		writeTag(output, SERIALIZE_MAP);
+		writeVarint(output, static_cast<uint32_t>(map.size()));
+		for (const std::pair<const std::string, Boxed_Value>& element : map) {
+			writeString(element.first, output, strings);
+			result = writeValue(element.second, output, strings, depth + 1) && result;
+		}
+		return result;
+	}
+	if (value.is_type(user_type<std::list<Boxed_Value> >())) {
+		const std::list<Boxed_Value>& list = boxed_cast<const std::list<Boxed_Value>&>(value);
+		writeTag(output, SERIALIZE_LIST);
+		writeVarint(output, static_cast<uint32_t>(list.size()));
+		for (const Boxed_Value& element : list) {
+			result = writeValue(element, output, strings, depth + 1) && result;
+		}
+		return result;
+	}
+
+	// Typed containers, with their numbers written as one block.
+	if (value.is_type(user_type<std::vector<int> >())) {
+		const std::vector<int>& vector = boxed_cast<const std::vector<int>&>(value);
+		writeTag(output, SERIALIZE_VECTORINT);
+		writeVarint(output, static_cast<uint32_t>(vector.size()));
+		output.write(vector.data(), vector.size() * sizeof(int));
+		return true;
+	}
+	if (value.is_type(user_type<std::vector<float> >())) {
+		const std::vector<float>& vector = boxed_cast<const std::vector<float>&>(value);
+		writeTag(output, SERIALIZE_VECTORFLOAT);
+		writeVarint(output, static_cast<uint32_t>(vector.size()));
+		output.write(vector.data(), vector.size() * sizeof(float));
+		return true;
+	}
+	if (value.is_type(user_type<std::vector<std::string> >())) {
+		const std::vector<std::string>& vector = boxed_cast<const std::vector<std::string>&>(value);
+		writeTag(output, SERIALIZE_STRINGVECTOR);
+		writeVarint(output, static_cast<uint32_t>(vector.size()));
+		for (const std::string& element : vector) {
+			writeString(element, output, strings);
+		}
+		return true;
+	}
+	if (value.is_type(user_type<std::map<std::string, bool> >())) {
+		const std::map<std::string, bool>& map = boxed_cast<const std::map<std::string, bool>&>(value);
+		writeTag(output, SERIALIZE_STRINGBOOLMAP);
+		writeVarint(output, static_cast<uint32_t>(map.size()));
+		for (const std::pair<const std::string, bool>& element : map) {
+			writeString(element.first, output, strings);
+			output.writeBool(element.second);
+		}
+		return true;
+	}
+	if (value.is_type(user_type<std::map<std::string, int> >())) {
+		const std::map<std::string, int>& map = boxed_cast<const std::map<std::string, int>&>(value);
+		writeTag(output, SERIALIZE_STRINGINTMAP);
+		writeVarint(output, static_cast<uint32_t>(map.size()));
+		for (const std::pair<const std::string, int>& element : map) {
+			writeString(element.first, output, strings);
+			output.writeInt(element.second);
+		}
+		return true;
+	}
+	if (value.is_type(user_type<std::map<std::string, float> >())) {
+		const std::map<std::string, float>& map = boxed_cast<const std::map<std::string, float>&>(value);
+		writeTag(output, SERIALIZE_STRINGFLOATMAP);
+		writeVarint(output, static_cast<uint32_t>(map.size()));
+		for (const std::pair<const std::string, float>& element : map) {
+			writeString(element.first, output, strings);
+			output.writeFloat(element.second);
+		}
+		return true;
+	}
+
+	pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Cannot serialize a value of type %s.", value.get_type_info().name().c_str());
+	writeTag(output, SERIALIZE_UNDEFINED);
+	return false;
+}
+
+bool data::readString(ByteData& input, SerializeStrings& strings, std::string* value) {
+	int tag = input.readByte();
+	uint32_t size;
+	if (tag == SERIALIZE_STRINGREF) {
+		if (!readVarint(input, &size) || size >= strings.read.size()) {
+			return false;
+		}
+		*value = strings.read[size];
+		return true;
+	}
+	if (tag != SERIALIZE_STRING || !readCount(input, &size)) {
+		return false;
+	}
+	value->assign(reinterpret_cast<const char*>(input.getPointer() + input.tell()), size);
+	input.seek(input.tell() + size);
+	strings.read.push_back(*value);
+	return true;
+}
+
+chaiscript::Boxed_Value data::readValue(ByteData& input, SerializeStrings& strings, int depth) {
+	using chaiscript::Boxed_Value;
+	using chaiscript::var;
+
+	if (depth > SERIALIZE_MAX_DEPTH || input.isEOF()) {
+		pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Serialized data is invalid.");
+		return Boxed_Value();
+	}
+
+	int tag = input.readByte();
+	uint32_t count = 0;
+	switch (tag) {
+		case SERIALIZE_UNDEFINED:
+			return Boxed_Value();
+		case SERIALIZE_FALSE:
+			return var(false);
+		case SERIALIZE_TRUE:
+			return var(true);
+		case SERIALIZE_INT:
+			return var(input.readInt());
+		case SERIALIZE_LONG: {
+			int64_t integer = 0;
+			input.read(&integer, sizeof(integer));
+			return var(static_cast<long long>(integer));
+		}
+		case SERIALIZE_FLOAT:
+			return var(input.readFloat());
+		case SERIALIZE_DOUBLE:
+			return var(input.readDouble());
+		case SERIALIZE_STRING:
+		case SERIALIZE_STRINGREF: {
+			std::string value;
+			input.seek(input.tell() - 1);
+			if (!readString(input, strings, &value)) {
+				break;
+			}
+			return var(value);
+		}
+		case SERIALIZE_VECTOR: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::vector<Boxed_Value> vector;
+			vector.reserve(count);
+			for (uint32_t i = 0; i < count; i++) {
+				vector.push_back(readValue(input, strings, depth + 1));
+			}
+			return var(vector);
+		}
+		case SERIALIZE_MAP: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::map<std::string, Boxed_Value> map;
+			std::string key;
+			for (uint32_t i = 0; i < count; i++) {
+				if (!readString(input, strings, &key)) {
+					return var(map);
+				}
+				map[key] = readValue(input, strings, depth + 1);
+			}
+			return var(map);
+		}
+		case SERIALIZE_LIST: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::list<Boxed_Value> list;
+			for (uint32_t i = 0; i < count; i++) {
+				list.push_back(readValue(input, strings, depth + 1));
+			}
+			return var(list);
+		}
+		case SERIALIZE_VECTORINT: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::vector<int> vector(count);
+			input.read(vector.data(), count * sizeof(int));
+			return var(vector);
+		}
+		case SERIALIZE_VECTORFLOAT: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::vector<float> vector(count);
+			input.read(vector.data(), count * sizeof(float));
+			return var(vector);
+		}
+		case SERIALIZE_STRINGVECTOR: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::vector<std::string> vector(count);
+			for (uint32_t i = 0; i < count; i++) {
+				readString(input, strings, &vector[i]);
+			}
+			return var(vector);
+		}
+		case SERIALIZE_STRINGBOOLMAP: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::map<std::string, bool> map;
+			std::string key;
+			for (uint32_t i = 0; i < count && readString(input, strings, &key); i++) {
+				map[key] = input.readBool();
+			}
+			return var(map);
+		}
+		case SERIALIZE_STRINGINTMAP: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::map<std::string, int> map;
+			std::string key;
+			for (uint32_t i = 0; i < count && readString(input, strings, &key); i++) {
+				map[key] = input.readInt();
+			}
+			return var(map);
+		}
+		case SERIALIZE_STRINGFLOATMAP: {
+			if (!readCount(input, &count)) {
+				break;
+			}
+			std::map<std::string, float> map;
+			std::string key;
+			for (uint32_t i = 0; i < count && readString(input, strings, &key); i++) {
+				map[key] = input.readFloat();
+			}
+			return var(map);
+		}
+	}
+
+	pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Serialized data is invalid at byte %d.", input.tell());
+	return Boxed_Value();
+}
+
+namespace {
+
+bool isNativeLittleEndian() {
+	uint16_t value = 1;
+	uint8_t first;
+	memcpy(&first, &value, sizeof(first));
+	return first == 1;
+}
+
+/**
+ * Gets the number of bytes of a number in a pack format, or 0 if the character isn't a number.
+ */
+int getPackSize(char type) {
+	switch (type) {
+		case 'b':
+		case 'B':
+			return 1;
+		case 'h':
+		case 'H':
+			return 2;
+		case 'i':
+		case 'I':
+		case 'f':
+			return 4;
+		case 'd':
+			return 8;
+	}
+	return 0;
+}
+
+void packInteger(ByteData& output, uint64_t value, int size, bool littleEndian) {
+	uint8_t bytes[8];
+	for (int i = 0; i < size; i++) {
+		int shift = littleEndian ? i : size - 1 - i;
+		bytes[i] = static_cast<uint8_t>(value >> (shift * 8));
+	}
+	output.write(bytes, size);
+}
+
+uint64_t unpackInteger(const uint8_t* bytes, int size, bool littleEndian) {
+	uint64_t value = 0;
+	for (int i = 0; i < size; i++) {
+		int shift = littleEndian ? i : size - 1 - i;
+		value |= static_cast<uint64_t>(bytes[i]) << (shift * 8);
+	}
+	return value;
+}
+
+}  // namespace
+
+ByteData data::pack(const std::string& format, const std::vector<chaiscript::Boxed_Value>& values) {
+	using chaiscript::Boxed_Value;
+	using chaiscript::boxed_cast;
+	using chaiscript::user_type;
+
+	ByteData output;
+	bool littleEndian = true;
+	size_t index = 0;
+	for (char type : format) {
+		switch (type) {
+			case '<':
+				littleEndian = true;
+				continue;
+			case '>':
+				littleEndian = false;
+				continue;
+			case '=':
+				littleEndian = isNativeLittleEndian();
+				continue;
+			case 'x':
+				output.writeByte(0);
+				continue;
+			case ' ':
+				continue;
+		}
+
+		if (index >= values.size()) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] love.data.pack needs more values for the format %s.", format.c_str());
+			return ByteData();
+		}
+		const Boxed_Value& value = values[index++];
+
+		if (type == 's' || type == 'z') {
+			if (!value.is_type(user_type<std::string>())) {
+				pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] love.data.pack expected a string for value %d.", static_cast<int>(index));
+				return ByteData();
+			}
+			const std::string& str = boxed_cast<const std::string&>(value);
+			if (type == 's') {
+				packInteger(output, str.size(), 4, littleEndian);
+				output.write(str.data(), str.size());
+			} else {
+				output.write(str.c_str(), str.size() + 1);
+			}
+			continue;
+		}
+
+		int size = getPackSize(type);
+		if (size == 0) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Unknown love.data.pack format '%c'.", type);
+			return ByteData();
+		}
+
+		uint64_t bits;
+		if (value.is_type(user_type<bool>())) {
+			bits = boxed_cast<bool>(value) ? 1 : 0;
+		} else if (value.get_type_info().is_arithmetic()) {
+			chaiscript::Boxed_Number number(value);
+			if (type == 'f') {
+				float f = number.get_as<float>();
+				uint32_t b;
+				memcpy(&b, &f, sizeof(b));
+				bits = b;
+			} else if (type == 'd') {
+				double d = number.get_as<double>();
+				memcpy(&bits, &d, sizeof(bits));
+			} else {
+				bits = static_cast<uint64_t>(number.get_as<int64_t>());
+			}
+		} else {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] love.data.pack expected a number for value %d.", static_cast<int>(index));
+			return ByteData();
+		}
+		packInteger(output, bits, size, littleEndian);
 	}
 
-	// Output the hash.
-	std::string output(md5string);
 	return output;
 }
 
-std::string data::hash_sha1(const std::string& data) {
-	sha1::SHA1 s;
-	s.processBytes(data.c_str(), data.size());
-	uint32_t digest[5];
-	s.getDigest(digest);
-	char tmp[48];
-	snprintf(tmp, sizeof(tmp), "%08x%08x%08x%08x%08x",
-		 (unsigned int) digest[0], (unsigned int) digest[1],
-		 (unsigned int) digest[2], (unsigned int) digest[3],
-		 (unsigned int) digest[4]);
-	return std::string(tmp);
+std::vector<chaiscript::Boxed_Value> data::unpack(const std::string& format, const std::string& input) {
+	ByteData data;
+	data.wrap(input.data(), input.size());
+	return unpack(format, data, 0);
+}
+
+std::vector<chaiscript::Boxed_Value> data::unpack(const std::string& format, ByteData& input) {
+	return unpack(format, input, 0);
+}
+
+std::vector<chaiscript::Boxed_Value> data::unpack(const std::string& format, ByteData& input, int offset) {
+	using chaiscript::var;
+
+	std::vector<chaiscript::Boxed_Value> values;
+	const uint8_t* bytes = input.getPointer();
+	size_t size = static_cast<size_t>(input.getSize());
+	size_t position = static_cast<size_t>(offset);
+	if (offset < 0 || position > size) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] love.data.unpack offset %d is outside the data.", offset);
+		return values;
+	}
+
+	bool littleEndian = true;
+	bool truncated = false;
+	for (char type : format) {
+		switch (type) {
+			case '<':
+				littleEndian = true;
+				continue;
+			case '>':
+				littleEndian = false;
+				continue;
+			case '=':
+				littleEndian = isNativeLittleEndian();
+				continue;
+			case ' ':
+				continue;
+		}
+
+		if (type == 'x') {
+			if (position >= size) {
+				truncated = true;
+				break;
+			}
+			position++;
+			continue;
+		}
+
+		if (type == 's') {
+			if (size - position < 4) {
+				truncated = true;
+				break;
+			}
+			uint64_t length = unpackInteger(bytes + position, 4, littleEndian);
+			position += 4;
+			if (length > size - position) {
+				truncated = true;
+				break;
+			}
+			values.push_back(var(std::string(reinterpret_cast<const char*>(bytes + position), length)));
+			position += length;
+			continue;
+		}
+
+		if (type == 'z') {
+			const uint8_t* end = static_cast<const uint8_t*>(memchr(bytes + position, 0, size - position));
+			if (end == NULL) {
+				truncated = true;
+				break;
+			}
+			values.push_back(var(std::string(reinterpret_cast<const char*>(bytes + position), end - (bytes + position))));
+			position = end - bytes + 1;
+			continue;
+		}
+
+		int valueSize = getPackSize(type);
+		if (valueSize == 0) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] Unknown love.data.unpack format '%c'.", type);
+			return std::vector<chaiscript::Boxed_Value>();
+		}
+		if (size - position < static_cast<size_t>(valueSize)) {
+			truncated = true;
+			break;
+		}
+		uint64_t bits = unpackInteger(bytes + position, valueSize, littleEndian);
+		position += valueSize;
+
+		switch (type) {
+			case 'b':
+				values.push_back(var(static_cast<int>(static_cast<int8_t>(bits))));
+				break;
+			case 'B':
+				values.push_back(var(static_cast<int>(static_cast<uint8_t>(bits))));
+				break;
+			case 'h':
+				values.push_back(var(static_cast<int>(static_cast<int16_t>(bits))));
+				break;
+			case 'H':
+				values.push_back(var(static_cast<int>(static_cast<uint16_t>(bits))));
+				break;
+			case 'i':
+				values.push_back(var(static_cast<int>(static_cast<int32_t>(bits))));
+				break;
+			case 'I':
+				values.push_back(var(static_cast<long long>(static_cast<uint32_t>(bits))));
+				break;
+			case 'f': {
+				uint32_t b = static_cast<uint32_t>(bits);
+				float f;
+				memcpy(&f, &b, sizeof(f));
+				values.push_back(var(f));
+				break;
+			}
+			case 'd': {
+				double d;
+				memcpy(&d, &bits, sizeof(d));
+				values.push_back(var(d));
+				break;
+			}
+		}
+	}
+
+	if (truncated) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [data] love.data.unpack ran out of data at byte %d.", static_cast<int>(position));
+		return std::vector<chaiscript::Boxed_Value>();
+	}
+
+	values.push_back(var(static_cast<int>(position)));
+	return values;
 }
+#endif
 
 }  // namespace love
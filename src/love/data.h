@@ -2,6 +2,24 @@
 #define SRC_LOVE_DATA_H_
 
 #include <string>
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "Types/Data/Struct.h"
+#include "Types/Data/ByteData.h"
+#include "Types/Data/SavestateEncoder.h"
+#include "Types/Data/Compressor.h"
+
+#ifdef __HAVE_CHAISCRIPT__
+#include <chaiscript/chaiscript.hpp>
+#endif
+
+using love::Types::Data::StructType;
+using love::Types::Data::ByteData;
+using love::Types::Data::SavestateEncoder;
+using love::Types::Data::Compressor;
 
 namespace love {
 /**
@@ -30,6 +48,31 @@ class data {
 	std::string compress(const std::string& str, int level);
 	std::string compress(const std::string& str);
 
+	/**
+	 * Compresses a string using a specific compression format.
+	 *
+	 * @param format The format to use: "zlib", "gzip", "deflate" or "lz4". LZ4 compresses less, but is many times faster, especially when decompressing.
+	 * @param str The raw (un-compressed) string to compress.
+	 * @param level (-1) The level of compression to use with the zlib formats, between 0 and 9. -1 indicates the default level.
+	 *
+	 * @return Compressed data in the form of a string.
+	 *
+	 * @see love.data.decompress
+	 *
+	 * @code
+	 * var compressed = love.data.compress("lz4", levelData)
+	 * var decompressed = love.data.decompress("lz4", compressed)
+	 * @endcode
+	 */
+	std::string compress(const std::string& format, const std::string& str, int level);
+	std::string compress(const std::string& format, const std::string& str);
+
+	/**
+	 * Compresses the contents of a ByteData, without copying them to a string first.
+	 */
+	std::string compress(const std::string& format, ByteData& data, int level);
+	std::string compress(const std::string& format, ByteData& data);
+
 	/**
 	 * Decompresses a compressed string.
 	 *
@@ -41,6 +84,56 @@ class data {
 	 */
 	std::string decompress(const std::string& str);
 
+	/**
+	 * Decompresses a string that was compressed using a specific compression format.
+	 *
+	 * @param format The format that was used to compress the string: "zlib", "gzip", "deflate" or "lz4".
+	 * @param str A string containing data previously compressed with love.data.compress().
+	 *
+	 * @return A string containing the raw decompressed data.
+	 *
+	 * @see love.data.compress
+	 */
+	std::string decompress(const std::string& format, const std::string& str);
+
+	/**
+	 * Decompresses the contents of a ByteData, without copying them to a string first.
+	 */
+	std::string decompress(const std::string& format, ByteData& data);
+
+	/**
+	 * Creates a new stream that compresses data in chunks.
+	 *
+	 * @param format The format to compress to: "zlib", "gzip" or "deflate".
+	 * @param level (-1) The level of compression to use, between 0 and 9. -1 indicates the default level.
+	 *
+	 * @return The new Compressor, or NULL if the format is unknown.
+	 *
+	 * @see love.data.newDecompressor
+	 *
+	 * @code
+	 * var compressor = love.data.newCompressor("gzip")
+	 * var output = ""
+	 * for (chunk : chunks) {
+	 *   output += compressor.push(chunk)
+	 * }
+	 * output += compressor.finish()
+	 * @endcode
+	 */
+	std::shared_ptr<Compressor> newCompressor(const std::string& format, int level);
+	std::shared_ptr<Compressor> newCompressor(const std::string& format);
+
+	/**
+	 * Creates a new stream that decompresses data in chunks.
+	 *
+	 * @param format The format to decompress from: "zlib", "gzip" or "deflate".
+	 *
+	 * @return The new Compressor, or NULL if the format is unknown.
+	 *
+	 * @see love.data.newCompressor
+	 */
+	std::shared_ptr<Compressor> newDecompressor(const std::string& format);
+
 	/**
 	 * Encode Data or a string to a Data or string in one of the EncodeFormats.
 	 *
@@ -54,6 +147,11 @@ class data {
 	 */
 	std::string encode(const std::string& containerType, const std::string& format, const std::string& sourceString);
 
+	/**
+	 * Encodes the contents of a ByteData, without copying them to a string first.
+	 */
+	std::string encode(const std::string& containerType, const std::string& format, ByteData& source);
+
 	/**
 	 * Decode Data or a string to a Data or string in one of the EncodeFormats.
 	 *
@@ -70,12 +168,12 @@ class data {
 	/**
 	 * Compute the message digest of specified string with specified algorithm.
 	 *
-	 * @param hashFunction Hash algorithm to use (md5, sha1).
+	 * @param hashFunction Hash algorithm to use (md5, sha1, xxh64, crc32). xxh64 and crc32 aren't cryptographic, but are much faster, which suits cache keys and integrity checks.
 	 * @param data String to hash.
 	 *
 	 * @todo Add sha256, sha512, etc.
 	 *
-	 * @return Raw message digest string.
+	 * @return The message digest, as a lowercase hexadecimal string.
 	 *
 	 * @code
 	 * var message = "Hello World!"
@@ -85,9 +183,192 @@ class data {
 	 */
 	std::string hash(const std::string& hashFunction, const std::string& data);
 
+	/**
+	 * Computes the message digest of the contents of a ByteData, without copying them to a string first.
+	 */
+	std::string hash(const std::string& hashFunction, ByteData& data);
+
+	/**
+	 * Creates a new ByteData of the given size, filled with zeros.
+	 *
+	 * @param size The number of bytes.
+	 *
+	 * @return The new ByteData.
+	 *
+	 * @code
+	 * var level = love.data.newByteData(64 * 64)
+	 * level.setUint8(0, 12)
+	 * love.filesystem.write("level.bin", level)
+	 * @endcode
+	 */
+	ByteData newByteData(int size);
+
+	/**
+	 * Creates a new ByteData holding a copy of the given string.
+	 */
+	ByteData newByteData(const std::string& contents);
+
+	/**
+	 * Declares a new record type with a fixed set of typed fields.
+	 *
+	 * A constructor with the name of the record type becomes available to the script. The fields of its instances are stored in fixed slots, rather than in the attribute map of a script class.
+	 *
+	 * @param name The name of the record type, which is also the name of its constructor.
+	 * @param fields The fields of the record, as "name:type". The type can be float, int, bool or string, and defaults to float.
+	 *
+	 * @return The record type, or NULL if the fields are invalid, or a different record type with the same name exists.
+	 *
+	 * @code
+	 * love.data.newStruct("Sprite", ["x:float", "y:float", "frame:int", "visible:bool"])
+	 * var sprite = Sprite()
+	 * sprite.x = 100.0f
+	 * sprite.frame += 1
+	 * @endcode
+	 */
+	StructType* newStruct(const std::string& name, const std::vector<std::string>& fields);
+
+	#ifdef __HAVE_CHAISCRIPT__
+	/**
+	 * Serializes a value into a compact binary string.
+	 *
+	 * Supports numbers, strings, booleans, Vector, Map and List, along with the typed vectors and maps, nested in any combination. Repeated strings, including map keys, are only stored once.
+	 *
+	 * @param value The value to serialize.
+	 *
+	 * @return The serialized value.
+	 *
+	 * @see love.data.deserialize
+	 *
+	 * @code
+	 * def savestate() {
+	 *   return love.data.serialize(["score": score, "enemies": enemies])
+	 * }
+	 *
+	 * def loadstate(data) {
+	 *   var state = love.data.deserialize(data)
+	 *   score = state["score"]
+	 *   enemies = state["enemies"]
+	 *   return true
+	 * }
+	 * @endcode
+	 */
+	std::string serialize(const chaiscript::Boxed_Value& value);
+
+	/**
+	 * Serializes a value at the cursor of the given ByteData.
+	 *
+	 * @return True if every part of the value could be serialized.
+	 */
+	bool serialize(const chaiscript::Boxed_Value& value, ByteData& output);
+
+	/**
+	 * Deserializes a value from a string made with love.data.serialize().
+	 *
+	 * @return The deserialized value, or an undefined value if the data is invalid.
+	 *
+	 * @see love.data.serialize
+	 */
+	chaiscript::Boxed_Value deserialize(const std::string& input);
+
+	/**
+	 * Deserializes a value at the cursor of the given ByteData.
+	 */
+	chaiscript::Boxed_Value deserialize(ByteData& input);
+
+	/**
+	 * Packs values into a ByteData, according to a format string.
+	 *
+	 * Each character of the format packs one value:
+	 * - b, B: Signed and unsigned 8-bit integers.
+	 * - h, H: Signed and unsigned 16-bit integers.
+	 * - i, I: Signed and unsigned 32-bit integers.
+	 * - f, d: 32-bit and 64-bit floating point numbers.
+	 * - s: A string, prefixed with its size as a 32-bit integer.
+	 * - z: A zero-terminated string.
+	 * - x: A zero byte, which doesn't take a value.
+	 * - <, >, =: Switches to little endian, big endian, or the native byte order. Defaults to little endian.
+	 *
+	 * @param format The format of the values.
+	 * @param values The values to pack.
+	 *
+	 * @return The packed values. The ByteData is empty if the values don't match the format.
+	 *
+	 * @see love.data.unpack
+	 *
+	 * @code
+	 * var packet = love.data.pack(">Hfz", [12, 3.5f, "player"])
+	 * var values = love.data.unpack(">Hfz", packet)
+	 * @endcode
+	 */
+	ByteData pack(const std::string& format, const std::vector<chaiscript::Boxed_Value>& values);
+
+	/**
+	 * Unpacks values from a ByteData, according to a format string.
+	 *
+	 * @param format The format of the values, as in love.data.pack().
+	 * @param data The data to unpack.
+	 * @param offset (0) The position in bytes to start unpacking from.
+	 *
+	 * @return The unpacked values, followed by the position after the last value. Empty if the data is too short.
+	 *
+	 * @see love.data.pack
+	 */
+	std::vector<chaiscript::Boxed_Value> unpack(const std::string& format, ByteData& data, int offset);
+	std::vector<chaiscript::Boxed_Value> unpack(const std::string& format, ByteData& data);
+	std::vector<chaiscript::Boxed_Value> unpack(const std::string& format, const std::string& data);
+	#endif
+
+	/**
+	 * Gets statistics about the encoded savestates.
+	 *
+	 * Savestates are encoded when the "savestatedelta" or "savestatecompress" options are enabled in conf(). With "savestatedelta", each state only holds the bytes that changed since the state before it, with a full keyframe at least every 60 states. This keeps rewind buffers small. Delta states can only be loaded in the session that saved them, while their keyframe is still in memory, so they are meant for rewind and run-ahead, rather than for keeping.
+	 *
+	 * @return A map with the number of "frames", "keyframes" and "deltas" saved, the "bytes" and "rawBytes" of the last state before and after encoding, their "averageBytes" and "averageRawBytes" per frame, and the number of "keyframesInMemory".
+	 *
+	 * @code
+	 * def conf(t) {
+	 *   t.options["savestatedelta"] = true
+	 * }
+	 *
+	 * def draw() {
+	 *   var stats = love.data.getSavestateStats()
+	 *   love.graphics.print("State: " + to_string(stats["bytes"]) + " bytes", 10, 10)
+	 * }
+	 * @endcode
+	 */
+	std::map<std::string, int> getSavestateStats();
+
+	/**
+	 * Gets the encoder that the savestates go through.
+	 */
+	SavestateEncoder& getSavestateEncoder();
+
+	bool unload();
+
 	private:
-	std::string hash_md5(const std::string& data);
-	std::string hash_sha1(const std::string& data);
+	std::string compress(const std::string& format, const uint8_t* input, size_t size, int level);
+	std::string decompress(const std::string& format, const uint8_t* input, size_t size);
+	std::string encode(const std::string& format, const uint8_t* source, size_t size);
+	std::string hash(const std::string& hashFunction, const uint8_t* data, size_t size);
+	std::shared_ptr<Compressor> newStream(const std::string& format, int level, bool decompress);
+
+	#ifdef __HAVE_CHAISCRIPT__
+	/**
+	 * The strings that have been written or read so far, used to replace repeated strings with their index.
+	 */
+	struct SerializeStrings {
+		std::map<std::string, unsigned int> written;
+		std::vector<std::string> read;
+	};
+
+	bool writeValue(const chaiscript::Boxed_Value& value, ByteData& output, SerializeStrings& strings, int depth);
+	void writeString(const std::string& value, ByteData& output, SerializeStrings& strings);
+	chaiscript::Boxed_Value readValue(ByteData& input, SerializeStrings& strings, int depth);
+	bool readString(ByteData& input, SerializeStrings& strings, std::string* value);
+	#endif
+
+	std::list<StructType*> m_structs;
+	SavestateEncoder m_savestates;
 };
 
 }  // namespace love
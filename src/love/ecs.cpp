@@ -0,0 +1,23 @@
+#include "ecs.h"
+#include <list>
+#include "Types/ECS/World.h"
+
+using love::Types::ECS::World;
+
+namespace love {
+
+World* ecs::newWorld() {
+	World* world = new World();
+	m_worlds.push_back(world);
+	return world;
+}
+
+bool ecs::unload() {
+	for (std::list<World*>::iterator it = m_worlds.begin(); it != m_worlds.end(); ++it) {
+		delete *it;
+	}
+	m_worlds.clear();
+	return true;
+}
+
+}  // namespace love
@@ -0,0 +1,38 @@
+#ifndef SRC_LOVE_ECS_H_
+#define SRC_LOVE_ECS_H_
+
+#include <list>
+
+#include "Types/ECS/World.h"
+
+using love::Types::ECS::World;
+
+namespace love {
+
+/**
+ * Provides native storage and systems for large numbers of entities.
+ *
+ * @see love::Types::ECS::World
+ */
+class ecs {
+	public:
+	bool unload();
+
+	/**
+	 * Creates a new World, to hold entities and their components.
+	 *
+	 * @code
+	 * var world = love.ecs.newWorld()
+	 * @endcode
+	 *
+	 * @return The new World object.
+	 */
+	World* newWorld();
+
+	private:
+	std::list<World*> m_worlds;
+};
+
+}  // namespace love
+
+#endif  // SRC_LOVE_ECS_H_
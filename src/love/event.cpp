@@ -1,5 +1,6 @@
 #include "event.h"
 
+#include <vector>
 #include "../ChaiLove.h"
 
 namespace love {
@@ -9,6 +10,171 @@ void event::quit() {
 }
 
 void event::update() {
+	// Feed in any input recorded for this frame.
+	ChaiLove* app = ChaiLove::getInstance();
+	std::vector<pntr_app_event>& events = app->replay.beginFrame();
+	for (pntr_app_event& e : events) {
+		dispatch(&e);
+	}
+
+	pump();
+}
+
+void event::pump() {
+	// Deliver the batch of events queued since the last frame.
+	if (!m_queue.empty()) {
+		ChaiLove* app = ChaiLove::getInstance();
+		if (app->script != NULL) {
+			app->script->events(m_queue);
+		}
+		m_queue.clear();
+	}
+}
+
+void event::push(const Event& e) {
+	// Merge consecutive mouse movements, keeping the latest position and summing the deltas.
+	if (e.type == Event::MOUSEMOVED && !m_queue.empty() && m_queue.back().type == Event::MOUSEMOVED) {
+		Event& last = m_queue.back();
+		last.x = e.x;
+		last.y = e.y;
+		last.dx += e.dx;
+		last.dy += e.dy;
+		return;
+	}
+	m_queue.push_back(e);
+}
+
+void event::queue(Event::Type type, pntr_app_event* e) {
+	Event queued;
+	queued.type = type;
+	switch (e->type) {
+		case PNTR_APP_EVENTTYPE_KEY_DOWN:
+		case PNTR_APP_EVENTTYPE_KEY_UP:
+			queued.key = e->key;
+		break;
+
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
+			queued.x = e->mouseX;
+			queued.y = e->mouseY;
+			queued.button = e->mouseButton;
+		break;
+
+		case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
+			queued.x = e->mouseX;
+			queued.y = e->mouseY;
+			queued.dx = e->mouseDeltaX;
+			queued.dy = e->mouseDeltaY;
+		break;
+
+		case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
+			// Matches wheelmoved(x, y), which is given the wheel movement as x.
+			queued.x = e->mouseWheel;
+		break;
+
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
+			queued.joystick = e->gamepad;
+			queued.button = e->gamepadButton;
+		break;
+
+		default:
+		break;
+	}
+	push(queued);
+}
+
+void event::push(pntr_app_event* e) {
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->replay.isPlaying()) {
+		return;
+	}
+	app->replay.recordEvent(e);
+	dispatch(e);
+}
+
+void event::dispatch(pntr_app_event* e) {
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->script == NULL) {
+		return;
+	}
+
+	// When the script handles events in batches, queue them up for the next update.
+	if (app->script->hasEventsCallback()) {
+		switch (e->type) {
+			case PNTR_APP_EVENTTYPE_KEY_DOWN:
+				queue(Event::KEYPRESSED, e);
+			break;
+			case PNTR_APP_EVENTTYPE_KEY_UP:
+				queue(Event::KEYRELEASED, e);
+			break;
+			case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
+				queue(Event::MOUSEPRESSED, e);
+			break;
+			case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
+				queue(Event::MOUSERELEASED, e);
+			break;
+			case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
+				queue(Event::MOUSEMOVED, e);
+			break;
+			case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
+				if (e->mouseWheel != 0) {
+					queue(Event::WHEELMOVED, e);
+				}
+			break;
+			case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
+				queue(Event::GAMEPADPRESSED, e);
+			break;
+			case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
+				queue(Event::GAMEPADRELEASED, e);
+			break;
+			default:
+			break;
+		}
+		return;
+	}
+
+	switch (e->type) {
+		case PNTR_APP_EVENTTYPE_KEY_DOWN:
+			app->keyboard.eventKeyPressed(e->key);
+		break;
+
+		case PNTR_APP_EVENTTYPE_KEY_UP:
+			app->keyboard.eventKeyReleased(e->key);
+		break;
+
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
+			app->mouse.mousepressed(e->mouseX, e->mouseY, app->mouse.getButtonName(e->mouseButton));
+		break;
+
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
+			app->mouse.mousereleased(e->mouseX, e->mouseY, app->mouse.getButtonName(e->mouseButton));
+		break;
+
+		case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
+			app->mouse.mousemoved(e->mouseX, e->mouseY, e->mouseDeltaX, e->mouseDeltaY);
+		break;
+
+		case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
+			if (e->mouseWheel != 0) {
+				// TODO: Add horizontal mouse wheel to pntr
+				app->mouse.wheelmoved(e->mouseWheel, 0);
+			}
+		break;
+
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
+			app->script->gamepadpressed(app->joystick[e->gamepad], app->joystick.getButtonName(e->gamepadButton));
+			app->script->joystickpressed(app->joystick[e->gamepad], e->gamepadButton);
+		break;
+
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
+			app->script->gamepadreleased(app->joystick[e->gamepad], app->joystick.getButtonName(e->gamepadButton));
+			app->script->joystickreleased(app->joystick[e->gamepad], e->gamepadButton);
+		break;
+
+		default:
+		break;
+	}
 }
 
 }  // namespace love
@@ -1,6 +1,13 @@
 #ifndef SRC_LOVE_EVENT_H_
 #define SRC_LOVE_EVENT_H_
 
+#include <vector>
+
+#include "pntr_app.h"
+#include "Types/Input/Event.h"
+
+using love::Types::Input::Event;
+
 namespace love {
 /**
  * Manages events, like keypresses.
@@ -13,7 +20,48 @@ class event {
 	void quit();
 	void update();
 
+	/**
+	 * Receives an input event from the frontend.
+	 *
+	 * While a replay is playing back, live input is ignored. While recording, the event is logged before being dispatched.
+	 */
+	void push(pntr_app_event* event);
+
+	/**
+	 * Sends the given input event over to the script callbacks.
+	 */
+	void dispatch(pntr_app_event* event);
+
+	/**
+	 * Adds an event to the batch for the events(list) callback, merging consecutive mouse movements.
+	 *
+	 * @param event The event to add, like one created with Event().
+	 *
+	 * ### Example
+	 *
+	 * @code
+	 * var e = Event()
+	 * e.type = love.event.KEYPRESSED
+	 * e.key = love.keyboard.getScancodeFromKey("space")
+	 * love.event.push(e)
+	 * @endcode
+	 */
+	void push(const Event& event);
+
+	/**
+	 * Delivers the events batched since the last frame to the events(list) callback right away, rather than on the next update.
+	 */
+	void pump();
+
 	bool m_shouldclose = false;
+
+	private:
+	/**
+	 * Adds an event from the frontend to the batch for the events(list) callback.
+	 */
+	void queue(Event::Type type, pntr_app_event* event);
+
+	std::vector<Event> m_queue;
 };
 
 }  // namespace love
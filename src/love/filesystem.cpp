@@ -1,13 +1,19 @@
+#include <string.h>
+#include <algorithm>
+#include <map>
 #include <string>
+#include <vector>
 
 #include "libretro.h"
 #include "physfs.h"
 #include "filesystem.h"
 #include "../ChaiLove.h"
 #include "Types/FileSystem/FileInfo.h"
+#include "Types/Data/Hasher.h"
 
 using love::Types::FileSystem::FileInfo;
 using love::Types::FileSystem::FileData;
+using love::Types::Data::Hasher;
 
 namespace love {
 
@@ -108,7 +114,7 @@ bool filesystem::load(const std::string& file) {
 }
 
 bool filesystem::exists(const std::string& file) {
-	return PHYSFS_exists(file.c_str()) != 0;
+	return m_index.stat(file) != NULL;
 }
 
 int filesystem::getSize(const std::string& file) {
@@ -136,6 +142,11 @@ PHYSFS_sint64 filesystem::getSize(PHYSFS_File* file) {
 }
 
 bool filesystem::unload() {
+	m_worker.clear();
+	m_cache.clear();
+	m_index.clear();
+	detachViews();
+	m_storedArchives.clear();
 	return true;
 }
 
@@ -162,16 +173,272 @@ unsigned char* filesystem::readBuffer(const std::string& filename) {
 }
 
 std::string filesystem::read(const std::string& filename) {
-	// Retrieve a character buffer.
-	const char* myBuf = pntr_load_file_text(filename.c_str());
-	std::string output = "";
-	if (myBuf != NULL) {
-		output = std::string(myBuf);
-		pntr_unload_file_text(myBuf);
+	const unsigned char* view;
+	size_t viewSize;
+	if (getView(filename, &view, &viewSize)) {
+		return std::string(reinterpret_cast<const char*>(view), viewSize);
+	}
+
+	std::string archive;
+	const std::string* cached = getCached(filename, &archive);
+	if (cached != NULL) {
+		return *cached;
+	}
+
+	PHYSFS_File* file = openFile(filename);
+	if (file == NULL) {
+		return "";
+	}
+
+	// Read the file straight into the string, rather than through a temporary buffer.
+	std::string output;
+	PHYSFS_sint64 size = getSize(file);
+	if (size > 0) {
+		output.resize(static_cast<size_t>(size));
+		PHYSFS_sint64 bytesRead = PHYSFS_readBytes(file, &output[0], static_cast<PHYSFS_uint64>(size));
+		output.resize(bytesRead > 0 ? static_cast<size_t>(bytesRead) : 0);
+	}
+	PHYSFS_close(file);
+
+	if (!archive.empty()) {
+		m_cache.put(filename, archive, output.data(), output.size());
 	}
 	return output;
 }
 
+std::shared_ptr<FileRequest> filesystem::readAsync(const std::string& filename, const FileRequest::Callback& callback) {
+	return pushRequest(FileRequest::REQUEST_READ, filename, callback);
+}
+
+std::shared_ptr<FileRequest> filesystem::readAsync(const std::string& filename) {
+	return readAsync(filename, FileRequest::Callback());
+}
+
+std::shared_ptr<FileRequest> filesystem::writeAsync(const std::string& name, const std::string& data, const FileRequest::Callback& callback) {
+	m_cache.evict(name);
+	std::shared_ptr<FileRequest> request(new FileRequest(FileRequest::REQUEST_WRITE, name));
+	request->m_contents = data;
+	request->m_callback = callback;
+	m_worker.push(request);
+	return request;
+}
+
+std::shared_ptr<FileRequest> filesystem::writeAsync(const std::string& name, const std::string& data) {
+	return writeAsync(name, data, FileRequest::Callback());
+}
+
+std::shared_ptr<FileRequest> filesystem::getDirectoryItemsAsync(const std::string& dir, const FileRequest::Callback& callback) {
+	return pushRequest(FileRequest::REQUEST_DIRECTORY, dir, callback);
+}
+
+std::shared_ptr<FileRequest> filesystem::getDirectoryItemsAsync(const std::string& dir) {
+	return getDirectoryItemsAsync(dir, FileRequest::Callback());
+}
+
+std::shared_ptr<FileRequest> filesystem::pushRequest(FileRequest::Type type, const std::string& filename, const FileRequest::Callback& callback) {
+	std::shared_ptr<FileRequest> request(new FileRequest(type, filename));
+	request->m_callback = callback;
+	m_worker.push(request);
+	return request;
+}
+
+void filesystem::update() {
+	handBack(m_worker.update(FileWorker::DEFAULT_BUDGET));
+}
+
+void filesystem::finishRequests() {
+	while (m_worker.getPendingCount() > 0) {
+		handBack(m_worker.update(static_cast<size_t>(-1)));
+	}
+}
+
+void filesystem::handBack(const std::vector<std::shared_ptr<FileRequest> >& finished) {
+	for (const std::shared_ptr<FileRequest>& request : finished) {
+		if (!request->m_error.empty()) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error with %s: %s", request->getFilename().c_str(), request->m_error.c_str());
+		}
+
+		// Reads and writes change what the cache should hold.
+		if (request->m_type == FileRequest::REQUEST_WRITE) {
+			invalidate(request->getFilename());
+		} else if (request->m_type == FileRequest::REQUEST_READ && m_cache.isEnabled() && !request->m_archive.empty() && request->m_error.empty()) {
+			m_cache.put(request->getFilename(), request->m_archive, request->m_contents.data(), request->m_contents.size());
+		}
+
+		try {
+			request->finish();
+		} catch (const std::exception& e) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error in the callback for %s: %s", request->getFilename().c_str(), e.what());
+		}
+	}
+}
+
+unsigned char* filesystem::loadFile(const std::string& filename, unsigned int* size) {
+	// Files stored in memory, either uncompressed in the archive or in the cache, only need to be copied.
+	const unsigned char* view;
+	size_t viewSize;
+	std::string archive;
+	const std::string* cached;
+	if (!getView(filename, &view, &viewSize)) {
+		cached = getCached(filename, &archive);
+		view = cached != NULL ? reinterpret_cast<const unsigned char*>(cached->data()) : NULL;
+		viewSize = cached != NULL ? cached->size() : 0;
+	}
+	if (view != NULL) {
+		unsigned char* buffer = static_cast<unsigned char*>(pntr_load_memory(viewSize + 1));
+		if (buffer == NULL) {
+			return NULL;
+		}
+		memcpy(buffer, view, viewSize);
+		if (size != NULL) {
+			*size = static_cast<unsigned int>(viewSize);
+		}
+		return buffer;
+	}
+
+	PHYSFS_File* file = openFile(filename);
+	if (file == NULL) {
+		return NULL;
+	}
+	PHYSFS_sint64 length = getSize(file);
+	unsigned char* buffer = length < 0 ? NULL : static_cast<unsigned char*>(pntr_load_memory(static_cast<size_t>(length) + 1));
+	if (buffer == NULL) {
+		PHYSFS_close(file);
+		return NULL;
+	}
+	PHYSFS_sint64 bytesRead = PHYSFS_readBytes(file, buffer, static_cast<PHYSFS_uint64>(length));
+	PHYSFS_close(file);
+	if (bytesRead != length) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error reading %s: %s", filename.c_str(), getLastError().c_str());
+		pntr_unload_memory(buffer);
+		return NULL;
+	}
+
+	if (!archive.empty()) {
+		m_cache.put(filename, archive, buffer, static_cast<size_t>(length));
+	}
+	if (size != NULL) {
+		*size = static_cast<unsigned int>(length);
+	}
+	return buffer;
+}
+
+bool filesystem::getView(const std::string& filename, const unsigned char** data, size_t* size) {
+	if (m_storedArchives.empty()) {
+		return false;
+	}
+
+	// Make sure the file isn't shadowed by another archive.
+	const char* realDir = PHYSFS_getRealDir(filename.c_str());
+	if (realDir == NULL) {
+		return false;
+	}
+	std::map<std::string, StoredArchive>::iterator archive = m_storedArchives.find(realDir);
+	if (archive == m_storedArchives.end()) {
+		return false;
+	}
+	return archive->second.find(filename, data, size);
+}
+
+std::shared_ptr<FileBuffer> filesystem::getSharedView(const std::string& filename) {
+	const unsigned char* view;
+	size_t viewSize;
+	if (!getView(filename, &view, &viewSize)) {
+		return std::shared_ptr<FileBuffer>();
+	}
+
+	// Forget the buffers that are gone, so the list doesn't grow with every file loaded.
+	m_views.erase(std::remove_if(m_views.begin(), m_views.end(), [](const std::weak_ptr<FileBuffer>& buffer) {
+		return buffer.expired();
+	}), m_views.end());
+
+	std::shared_ptr<FileBuffer> buffer = std::make_shared<FileBuffer>();
+	buffer->data.reset(const_cast<unsigned char*>(view), [](unsigned char*) {});
+	buffer->size = static_cast<unsigned int>(viewSize);
+	m_views.push_back(buffer);
+	return buffer;
+}
+
+void filesystem::detachViews() {
+	for (std::vector<std::weak_ptr<FileBuffer> >::iterator it = m_views.begin(); it != m_views.end(); ++it) {
+		std::shared_ptr<FileBuffer> buffer = it->lock();
+		if (buffer == NULL || buffer->size == 0) {
+			continue;
+		}
+		unsigned char* copy = static_cast<unsigned char*>(pntr_load_memory(buffer->size));
+		if (copy == NULL) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Not enough memory to keep %u bytes from the unmounted archive", buffer->size);
+			buffer->data.reset();
+			buffer->size = 0;
+			continue;
+		}
+		memcpy(copy, buffer->data.get(), buffer->size);
+		buffer->data.reset(copy, pntr_unload_memory);
+	}
+	m_views.clear();
+}
+
+const std::string* filesystem::getCached(const std::string& filename, std::string* archive) {
+	archive->clear();
+	if (!m_cache.isEnabled()) {
+		return NULL;
+	}
+	const char* realDir = PHYSFS_getRealDir(filename.c_str());
+	if (realDir == NULL) {
+		return NULL;
+	}
+	*archive = realDir;
+	return m_cache.get(filename, *archive);
+}
+
+filesystem& filesystem::setCacheBudget(int bytes) {
+	m_cache.setBudget(bytes > 0 ? static_cast<size_t>(bytes) : 0);
+	return *this;
+}
+
+int filesystem::getCacheBudget() {
+	return static_cast<int>(m_cache.getBudget());
+}
+
+bool filesystem::preload(const std::vector<std::string>& paths) {
+	if (!m_cache.isEnabled()) {
+		pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Can't preload files without a cache budget.");
+		return false;
+	}
+
+	bool result = true;
+	for (const std::string& path : paths) {
+		unsigned char* buffer = loadFile(path, NULL);
+		if (buffer == NULL) {
+			result = false;
+			continue;
+		}
+		pntr_unload_memory(buffer);
+	}
+	return result;
+}
+
+bool filesystem::evict(const std::string& path) {
+	return m_cache.evict(path);
+}
+
+bool filesystem::evict() {
+	m_cache.clear();
+	return true;
+}
+
+std::map<std::string, int> filesystem::getCacheStats() {
+	std::map<std::string, int> stats = m_cache.getStats();
+
+	// Include the parsed modules that load() and require() reuse.
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->script != NULL) {
+		std::map<std::string, int> modules = app->script->getModuleCacheStats();
+		stats.insert(modules.begin(), modules.end());
+	}
+	return stats;
+}
+
 bool filesystem::unmount(const std::string& archive) {
 	pntr_app_log_ex(PNTR_APP_LOG_INFO, "[filesystem] Unmounting %s", archive.c_str());
 	int returnValue = PHYSFS_unmount(archive.c_str());
@@ -179,6 +446,11 @@ bool filesystem::unmount(const std::string& archive) {
 		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error unmounting: %s", getLastError().c_str());
 		return false;
 	}
+	m_cache.evictArchive(archive);
+	m_index.clear();
+	if (m_storedArchives.erase(archive) > 0) {
+		detachViews();
+	}
 	return true;
 }
 
@@ -202,6 +474,17 @@ bool filesystem::mount(const void *data, unsigned int size, const std::string& m
 	if (PHYSFS_mountMemory(data, (PHYSFS_uint64)size, NULL, "chailove.zip", mountpoint.c_str(), 1) == 0) {
 		return false;
 	}
+	m_index.clear();
+
+	// Uncompressed files can be used straight from the archive's memory.
+	if (m_storedArchives.erase("chailove.zip") > 0) {
+		detachViews();
+	}
+	StoredArchive stored(data, size, mountpoint);
+	if (stored.getCount() > 0) {
+		pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [filesystem] Using %d uncompressed files from memory", stored.getCount());
+		m_storedArchives.insert(std::make_pair(std::string("chailove.zip"), stored));
+	}
 	return true;
 }
 
@@ -223,6 +506,7 @@ bool filesystem::mount(const std::string& archive, const std::string& mountpoint
 			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error mounting '/': ", getLastError().c_str());
 			return false;
 		}
+		m_index.clear();
 		return true;
 	}
 
@@ -247,6 +531,7 @@ bool filesystem::mount(const std::string& archive, const std::string& mountpoint
 		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error mounting directory '%s' as '%s': %s", archive.c_str(), mountpoint.c_str(), getLastError().c_str());
 		return false;
 	}
+	m_index.clear();
 	return true;
 }
 
@@ -254,48 +539,27 @@ bool filesystem::mount(const std::string& archive, const std::string& mountpoint
  * Lists all items in the given directory.
  */
 std::vector<std::string> filesystem::getDirectoryItems(const std::string& dir) {
-	// Construct the list of files that will result.
-	std::vector<std::string> result;
-
-	// Ask PhysFS for the enumerated files.
-	char** rc = PHYSFS_enumerateFiles(dir.c_str());
-	if (rc != NULL) {
-		char **i;
-		for (i = rc; *i != NULL; i++) {
-			// Build the file string.
-			std::string thefile(*i);
-			result.push_back(thefile);
-		}
-		PHYSFS_freeList(rc);
-	} else {
+	const std::vector<std::string>* items = m_index.getDirectoryItems(dir);
+	if (items == NULL) {
 		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error enumerating files from %s", dir.c_str());
+		return std::vector<std::string>();
 	}
-
-	return result;
+	return *items;
 }
 
 bool filesystem::isDirectory(const std::string& filename) {
-	PHYSFS_Stat stat;
-	if (PHYSFS_stat(filename.c_str(), &stat) == 0) {
-		return false;
-	}
-	return stat.filetype == PHYSFS_FILETYPE_DIRECTORY;
+	const PHYSFS_Stat* stat = m_index.stat(filename);
+	return stat != NULL && stat->filetype == PHYSFS_FILETYPE_DIRECTORY;
 }
 
 bool filesystem::isFile(const std::string& filename) {
-	PHYSFS_Stat stat;
-	if (PHYSFS_stat(filename.c_str(), &stat) == 0) {
-		return false;
-	}
-	return stat.filetype == PHYSFS_FILETYPE_REGULAR;
+	const PHYSFS_Stat* stat = m_index.stat(filename);
+	return stat != NULL && stat->filetype == PHYSFS_FILETYPE_REGULAR;
 }
 
 bool filesystem::isSymlink(const std::string& filename) {
-	PHYSFS_Stat stat;
-	if (PHYSFS_stat(filename.c_str(), &stat) == 0) {
-		return false;
-	}
-	return stat.filetype == PHYSFS_FILETYPE_SYMLINK;
+	const PHYSFS_Stat* stat = m_index.stat(filename);
+	return stat != NULL && stat->filetype == PHYSFS_FILETYPE_SYMLINK;
 }
 
 std::vector<std::string> filesystem::lines(const std::string& filename) {
@@ -307,11 +571,12 @@ std::vector<std::string> filesystem::lines(const std::string& filename, const st
 	std::vector<std::string> strings;
 
 	if (!str.empty()) {
+		std::string separator = delimiter.empty() ? "\n" : delimiter;
 		std::string::size_type pos = 0;
 		std::string::size_type prev = 0;
-		while ((pos = str.find(delimiter, prev)) != std::string::npos) {
+		while ((pos = str.find(separator, prev)) != std::string::npos) {
 			strings.push_back(str.substr(prev, pos - prev));
-			prev = pos + 1;
+			prev = pos + separator.size();
 		}
 
 		// To get the last substring (or only, if delimiter is not found)
@@ -321,13 +586,21 @@ std::vector<std::string> filesystem::lines(const std::string& filename, const st
 	return strings;
 }
 
+std::shared_ptr<LineIterator> filesystem::newLineIterator(const std::string& filename, const std::string& delimiter) {
+	return std::shared_ptr<LineIterator>(new LineIterator(filename, delimiter));
+}
+
+std::shared_ptr<LineIterator> filesystem::newLineIterator(const std::string& filename) {
+	return newLineIterator(filename, "\n");
+}
+
 FileInfo filesystem::getInfo(const std::string& path) {
 	FileInfo fileInfo;
-	PHYSFS_Stat stat;
-	if (PHYSFS_stat(path.c_str(), &stat) == 0) {
+	const PHYSFS_Stat* stat = m_index.stat(path);
+	if (stat == NULL) {
 		return fileInfo;
 	}
-	switch(stat.filetype) {
+	switch(stat->filetype) {
 		case PHYSFS_FILETYPE_REGULAR:
 			fileInfo.type = "file";
 			break;
@@ -342,8 +615,8 @@ FileInfo filesystem::getInfo(const std::string& path) {
 			break;
 	}
 
-	fileInfo.modtime = stat.modtime;
-	fileInfo.size = stat.filesize;
+	fileInfo.modtime = stat->modtime;
+	fileInfo.size = stat->filesize;
 	return fileInfo;
 }
 
@@ -363,6 +636,7 @@ std::string filesystem::getSaveDirectory() {
 
 bool filesystem::createDirectory(const std::string& name) {
 	int ret = PHYSFS_mkdir(name.c_str());
+	m_index.forget(name);
 	if (ret == 0) {
 		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Failed to create directory: %s", getLastError().c_str());
 		return false;
@@ -371,14 +645,74 @@ bool filesystem::createDirectory(const std::string& name) {
 }
 
 bool filesystem::write(const std::string& name, const std::string& data) {
-	PHYSFS_File* file = PHYSFS_openWrite(name.c_str());
+	return write(name, data.data(), data.size(), false);
+}
+
+bool filesystem::write(const std::string& name, ByteData& data) {
+	return write(name, data.getPointer(), data.getSize(), false);
+}
+
+bool filesystem::append(const std::string& name, const std::string& data) {
+	return write(name, data.data(), data.size(), true);
+}
+
+bool filesystem::append(const std::string& name, ByteData& data) {
+	return write(name, data.getPointer(), data.getSize(), true);
+}
+
+bool filesystem::write(const std::string& name, const void* data, size_t size, bool append) {
+	invalidate(name);
+	PHYSFS_File* file = append ? PHYSFS_openAppend(name.c_str()) : PHYSFS_openWrite(name.c_str());
 	if (file == NULL) {
 		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error opening file for writing: %s", getLastError().c_str());
 		return false;
 	}
-	const char* buffer = data.c_str();
-	int bytesWritten = PHYSFS_writeBytes(file, (const void*)buffer, data.size());
-	return bytesWritten >= 0;
+	PHYSFS_sint64 bytesWritten = PHYSFS_writeBytes(file, data, size);
+	bool closed = PHYSFS_close(file) != 0;
+	return bytesWritten == static_cast<PHYSFS_sint64>(size) && closed;
+}
+
+std::shared_ptr<File> filesystem::newFile(const std::string& filename, const std::string& mode) {
+	std::shared_ptr<File> file(new File(filename));
+	file->open(mode);
+	return file;
+}
+
+std::shared_ptr<File> filesystem::newFile(const std::string& filename) {
+	return std::shared_ptr<File>(new File(filename));
+}
+
+void filesystem::invalidate(const std::string& filename) {
+	m_cache.evict(filename);
+	m_index.forget(filename);
+}
+
+std::string filesystem::hash(const std::string& filename, const std::string& hashFunction) {
+	Hasher hasher(hashFunction);
+	if (!hasher.isValid()) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Hash function not found: %s", hashFunction.c_str());
+		return "";
+	}
+
+	PHYSFS_File* file = openFile(filename);
+	if (file == NULL) {
+		return "";
+	}
+
+	// Stream the file through the hash, so that large files don't need to fit in memory.
+	std::vector<uint8_t> buffer(64 * 1024);
+	PHYSFS_sint64 bytesRead;
+	while ((bytesRead = PHYSFS_readBytes(file, buffer.data(), buffer.size())) > 0) {
+		hasher.update(buffer.data(), static_cast<size_t>(bytesRead));
+	}
+	bool failed = bytesRead < 0;
+	PHYSFS_close(file);
+
+	if (failed) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [filesystem] Error reading %s: %s", filename.c_str(), getLastError().c_str());
+		return "";
+	}
+	return hasher.finish();
 }
 
 std::string filesystem::getLastError() {
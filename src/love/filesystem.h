@@ -1,16 +1,35 @@
 #ifndef SRC_LOVE_FILESYSTEM_H_
 #define SRC_LOVE_FILESYSTEM_H_
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "pntr_app.h"
 #include "physfs.h"
+#include "Types/FileSystem/File.h"
 #include "Types/FileSystem/FileInfo.h"
 #include "Types/FileSystem/FileData.h"
+#include "Types/FileSystem/FileCache.h"
+#include "Types/FileSystem/FileRequest.h"
+#include "Types/FileSystem/FileWorker.h"
+#include "Types/FileSystem/LineIterator.h"
+#include "Types/FileSystem/PathIndex.h"
+#include "Types/FileSystem/StoredArchive.h"
+#include "Types/Data/ByteData.h"
 
 using love::Types::FileSystem::FileInfo;
 using love::Types::FileSystem::FileData;
+using love::Types::FileSystem::FileBuffer;
+using love::Types::FileSystem::File;
+using love::Types::FileSystem::FileCache;
+using love::Types::FileSystem::FileRequest;
+using love::Types::FileSystem::FileWorker;
+using love::Types::FileSystem::LineIterator;
+using love::Types::FileSystem::PathIndex;
+using love::Types::FileSystem::StoredArchive;
+using love::Types::Data::ByteData;
 
 namespace love {
 /**
@@ -40,6 +59,38 @@ class filesystem {
 	void* openRW(const std::string& filename);
 	unsigned char* readBuffer(const std::string& filename);
 
+	/**
+	 * Loads a file into memory from pntr_load_memory(), going through the file cache. This is how pntr loads images, sounds and fonts.
+	 *
+	 * @param filename The file to load.
+	 * @param size Receives the size of the file. Can be NULL.
+	 *
+	 * @return The contents of the file, to be freed with pntr_unload_file(), or NULL if it couldn't be read.
+	 */
+	unsigned char* loadFile(const std::string& filename, unsigned int* size);
+
+	/**
+	 * Finds a file that's stored uncompressed in an archive mounted from memory, so that it can be used without reading it.
+	 *
+	 * @param filename The file to find.
+	 * @param data Receives a read-only pointer to the file's bytes, valid while the archive is mounted.
+	 * @param size Receives the size of the file.
+	 *
+	 * @return True if the file is stored in a memory archive, false if it has to be read.
+	 */
+	bool getView(const std::string& filename, const unsigned char** data, size_t* size);
+
+	/**
+	 * Gets a FileBuffer around a file that's stored uncompressed in a memory archive.
+	 *
+	 * The buffer points into the archive until the archive is unmounted, when it is given a copy of the file's bytes instead.
+	 *
+	 * @return The buffer, or NULL if the file has to be read.
+	 *
+	 * @see getView
+	 */
+	std::shared_ptr<FileBuffer> getSharedView(const std::string& filename);
+
 	/**
 	 * Read the contents of a file.
 	 *
@@ -54,6 +105,62 @@ class filesystem {
 	 */
 	std::string read(const std::string& filename);
 
+	/**
+	 * Reads the contents of a file over the next frames, reading no more than a megabyte each frame so that large files don't hold up the game.
+	 *
+	 * @param filename The name (and path) of the file.
+	 * @param callback (optional) A function that is given the FileRequest once it's done, at the start of the frame in which it finishes.
+	 *
+	 * @return The FileRequest, which can be checked with isDone().
+	 *
+	 * @code
+	 * love.filesystem.readAsync("level2.txt", fun(request) {
+	 *   level = request.getContents()
+	 * })
+	 * @endcode
+	 *
+	 * @see love::Types::FileSystem::FileRequest
+	 */
+	std::shared_ptr<FileRequest> readAsync(const std::string& filename, const FileRequest::Callback& callback);
+	std::shared_ptr<FileRequest> readAsync(const std::string& filename);
+
+	/**
+	 * Writes data to a file in the save directory over the next frames. Requests run in the order they're made, so a later readAsync() of the same file sees the new contents.
+	 *
+	 * @param name The name (and path) of the file.
+	 * @param data The string data to write to the file.
+	 * @param callback (optional) A function that is given the FileRequest once it's done.
+	 *
+	 * @return The FileRequest.
+	 *
+	 * @code
+	 * love.filesystem.writeAsync("autosave.dat", love.data.serialize(state))
+	 * @endcode
+	 */
+	std::shared_ptr<FileRequest> writeAsync(const std::string& name, const std::string& data, const FileRequest::Callback& callback);
+	std::shared_ptr<FileRequest> writeAsync(const std::string& name, const std::string& data);
+
+	/**
+	 * Lists the files and subdirectories in a directory on the next frame.
+	 *
+	 * @param dir The directory.
+	 * @param callback (optional) A function that is given the FileRequest once it's done. Its getItems() has the results.
+	 *
+	 * @return The FileRequest.
+	 */
+	std::shared_ptr<FileRequest> getDirectoryItemsAsync(const std::string& dir, const FileRequest::Callback& callback);
+	std::shared_ptr<FileRequest> getDirectoryItemsAsync(const std::string& dir);
+
+	/**
+	 * Runs the next slice of the file requests, and hands back the ones that have finished, calling their callbacks.
+	 */
+	void update();
+
+	/**
+	 * Runs all the file requests to the end, and hands them back, so that queued writes aren't lost when the game closes.
+	 */
+	void finishRequests();
+
 	/**
 	 * Check whether a file or directory exists.
 	 *
@@ -202,6 +309,68 @@ class filesystem {
 	 */
 	bool write(const std::string& name, const std::string& data);
 
+	/**
+	 * Write the contents of a ByteData to a file in the save directory, without copying them to a string first.
+	 */
+	bool write(const std::string& name, ByteData& data);
+
+	/**
+	 * Append data to the end of a file in the save directory, creating the file if it doesn't exist.
+	 *
+	 * @param name The name (and path) of the file.
+	 * @param data The string data to append to the file.
+	 *
+	 * @return True if the data was appended, false otherwise.
+	 *
+	 * @see newFile
+	 */
+	bool append(const std::string& name, const std::string& data);
+
+	/**
+	 * Append the contents of a ByteData to the end of a file in the save directory.
+	 */
+	bool append(const std::string& name, ByteData& data);
+
+	/**
+	 * Creates a File, which stays open so it can be written to many times. Writes are buffered until the file is flushed or closed.
+	 *
+	 * @param filename The name (and path) of the file.
+	 * @param mode (optional) "r" to read, "w" to write over the file, or "a" to append to it. When not given, the file is not opened yet.
+	 *
+	 * @return The File.
+	 *
+	 * @code
+	 * var telemetry = love.filesystem.newFile("telemetry.csv", "a")
+	 * telemetry.write("frame,fps\n")
+	 * telemetry.close()
+	 * @endcode
+	 *
+	 * @see love::Types::FileSystem::File
+	 */
+	std::shared_ptr<File> newFile(const std::string& filename, const std::string& mode);
+	std::shared_ptr<File> newFile(const std::string& filename);
+
+	/**
+	 * Forgets what's known about a file that was changed, dropping it from the file cache and the path index.
+	 */
+	void invalidate(const std::string& filename);
+
+	/**
+	 * Computes the message digest of a file, reading it in chunks rather than loading it all into memory.
+	 *
+	 * @param filename The file to hash.
+	 * @param hashFunction Hash algorithm to use: md5, sha1, xxh64 or crc32.
+	 *
+	 * @return The message digest, as a lowercase hexadecimal string, or an empty string if the file couldn't be read.
+	 *
+	 * @see love.data.hash
+	 *
+	 * @code
+	 * var cacheKey = love.filesystem.hash("assets/level1.bin", "xxh64")
+	 * @endcode
+	 */
+	std::string hash(const std::string& filename, const std::string& hashFunction);
+
 	/**
 	 * Iterate over the lines in a file, with the given delimiter.
 	 *
@@ -211,10 +380,31 @@ class filesystem {
 	 * @return A vector array of strings representing all the lines in the given file.
 	 *
 	 * @see read
+	 * @see newLineIterator
 	 */
 	std::vector<std::string> lines(const std::string& filename, const std::string& delimiter);
 	std::vector<std::string> lines(const std::string& filename);
 
+	/**
+	 * Creates an iterator over the lines in a file, which reads the file a chunk at a time rather than loading it all into memory.
+	 *
+	 * @param filename The file to read the lines from.
+	 * @param delimiter ("\n") A string of characters representing what would be considered a new line.
+	 *
+	 * @return The LineIterator.
+	 *
+	 * @code
+	 * var lines = love.filesystem.newLineIterator("highscores.csv")
+	 * while (lines.hasNext()) {
+	 *   print(lines.next())
+	 * }
+	 * @endcode
+	 *
+	 * @see lines
+	 */
+	std::shared_ptr<LineIterator> newLineIterator(const std::string& filename, const std::string& delimiter);
+	std::shared_ptr<LineIterator> newLineIterator(const std::string& filename);
+
 	/**
 	 * Get the path to the executable that was used to run this application.
 	 *
@@ -223,6 +413,95 @@ class filesystem {
 	std::string getExecutablePath();
 
 	std::string getLastError();
+
+	/**
+	 * Sets how many bytes of file contents to keep in memory after they're read.
+	 *
+	 * Reading files from a compressed .chailove archive inflates them every time. With a cache, files that are read again, like the images of a level that gets reloaded, come straight from memory. The least recently used files are dropped when the budget is reached. The cache is disabled by default.
+	 *
+	 * @param bytes The most bytes to keep. 0 disables the cache.
+	 *
+	 * @code
+	 * def load() {
+	 *   love.filesystem.setCacheBudget(16 * 1024 * 1024)
+	 *   love.filesystem.preload(["level1.png", "jump.wav"])
+	 * }
+	 * @endcode
+	 *
+	 * @see preload
+	 * @see getCacheStats
+	 */
+	filesystem& setCacheBudget(int bytes);
+
+	/**
+	 * Gets how many bytes of file contents the cache can keep.
+	 */
+	int getCacheBudget();
+
+	/**
+	 * Reads the given files into the cache ahead of time.
+	 *
+	 * @param paths The files to read.
+	 *
+	 * @return True if all the files were cached, false if the cache is disabled or a file couldn't be read.
+	 *
+	 * @see setCacheBudget
+	 */
+	bool preload(const std::vector<std::string>& paths);
+
+	/**
+	 * Removes a file from the cache.
+	 *
+	 * @param path (all) The file to remove. When not provided, empties the whole cache.
+	 *
+	 * @return True if the file was cached.
+	 */
+	bool evict(const std::string& path);
+	bool evict();
+
+	/**
+	 * Gets the number of cache "hits", "misses" and "evictions", along with the number of "files" and "bytes" held, and the "budget".
+	 *
+	 * Also includes the number of parsed "modules" that load() and require() keep, and the "moduleHits" where one was reused rather than parsed again.
+	 */
+	std::map<std::string, int> getCacheStats();
+
+	private:
+	/**
+	 * Finds a file in the cache.
+	 *
+	 * @param filename The file to find.
+	 * @param archive Receives the archive or directory the file is in, or an empty string if the file shouldn't be cached.
+	 */
+	const std::string* getCached(const std::string& filename, std::string* archive);
+
+	bool write(const std::string& name, const void* data, size_t size, bool append);
+
+	std::shared_ptr<FileRequest> pushRequest(FileRequest::Type type, const std::string& filename, const FileRequest::Callback& callback);
+	void handBack(const std::vector<std::shared_ptr<FileRequest> >& finished);
+
+	/**
+	 * Copies the bytes of every buffer from getSharedView() out of the memory archives, before they are unmounted.
+	 */
+	void detachViews();
+
+	FileCache m_cache;
+	FileWorker m_worker;
+
+	/**
+	 * What's been found at each path, cleared whenever something is mounted, unmounted or written.
+	 */
+	PathIndex m_index;
+
+	/**
+	 * The uncompressed entries of the archives mounted from memory, keyed by the name they were mounted with.
+	 */
+	std::map<std::string, StoredArchive> m_storedArchives;
+
+	/**
+	 * The buffers that still point into the memory archives.
+	 */
+	std::vector<std::weak_ptr<FileBuffer> > m_views;
 };
 
 }  // namespace love
@@ -60,6 +60,10 @@ graphics& graphics::point(Point* p) {
 	return point(p->x, p->y);
 }
 
+graphics& graphics::point(const Vector2& position) {
+	return point(position.x, position.y);
+}
+
 /*
 TODO: Fix graphics.points(Vector<Points>)
 void graphics::points(std::vector<Point*> points) {
@@ -119,6 +123,26 @@ graphics& graphics::draw(Image* image, Quad quad, int x, int y) {
 	return *this;
 }
 
+graphics& graphics::draw(Image* image, Quad quad, const Vector2& position) {
+	return draw(image, quad, position.x, position.y);
+}
+
+graphics& graphics::draw(Image* image, const Vector2& position) {
+	return draw(image, position.x, position.y);
+}
+
+graphics& graphics::draw(Image* image, const Vector2& position, float r) {
+	return draw(image, position.x, position.y, r);
+}
+
+graphics& graphics::draw(Image* image, const Vector2& position, float r, const Vector2& scale) {
+	return draw(image, position.x, position.y, r, scale.x, scale.y, 0.0f, 0.0f);
+}
+
+graphics& graphics::draw(Image* image, const Vector2& position, float r, const Vector2& scale, const Vector2& origin) {
+	return draw(image, position.x, position.y, r, scale.x, scale.y, origin.x, origin.y);
+}
+
 graphics& graphics::draw(Image* image, int x, int y, float r, float sx, float sy, float ox, float oy) {
 	if (image == NULL || !image->loaded()) {
 		return *this;
@@ -175,6 +199,10 @@ Image* graphics::newImage(const std::string& filename) {
 	return ChaiLove::getInstance()->image.newImageData(filename);
 }
 
+Image* graphics::newImage(FileData& data) {
+	return ChaiLove::getInstance()->image.newImageData(data);
+}
+
 Quad graphics::newQuad(int x, int y, int width, int height, int sw, int sh) {
 	return Quad(x, y, width, height, sw, sh);
 }
@@ -311,6 +339,20 @@ Font* graphics::newFont(const std::string& filename) {
 	return NULL;
 }
 
+Font* graphics::newFont(FileData& data, int size) {
+	Font* font = new Font(data, size);
+	if (font->loaded()) {
+		return font;
+	}
+
+	delete font;
+	return NULL;
+}
+
+Font* graphics::newFont(FileData& data) {
+	return newFont(data, 16);
+}
+
 Font* graphics::newFont() {
 	Font* font = new Font();
 	if (font->loaded()) {
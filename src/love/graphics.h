@@ -10,12 +10,16 @@
 #include "Types/Graphics/Font.h"
 #include "Types/Graphics/Point.h"
 #include "Types/Graphics/Color.h"
+#include "Types/Math/Vector2.h"
+#include "Types/FileSystem/FileData.h"
 
 using love::Types::Graphics::Image;
 using love::Types::Graphics::Quad;
 using love::Types::Graphics::Font;
 using love::Types::Graphics::Point;
 using love::Types::Graphics::Color;
+using love::Types::Math::Vector2;
+using love::Types::FileSystem::FileData;
 
 namespace love {
 
@@ -73,6 +77,13 @@ class graphics {
 	 */
 	graphics& point(Point* p);
 
+	/**
+	 * Draws a point.
+	 *
+	 * @param position The position of the point.
+	 */
+	graphics& point(const Vector2& position);
+
 	// void points(std::vector<Point*>);
 	// void points(std::vector<Point>);
 
@@ -104,6 +115,16 @@ class graphics {
 	 */
 	Image* newImage(const std::string& filename);
 
+	/**
+	 * Creates a new Image from the contents of a FileData.
+	 *
+	 * @code
+	 * var logoData = love.filesystem.newFileData("logo.png")
+	 * var logo = love.graphics.newImage(logoData)
+	 * @endcode
+	 */
+	Image* newImage(FileData& data);
+
 
 	/**
 	 * Creates a new TrueType font, with the given font size.
@@ -116,6 +137,12 @@ class graphics {
 	Font* newFont(const std::string& filename, int size);
 	Font* newFont(const std::string& filename);
 
+	/**
+	 * Creates a new TrueType font from the contents of a FileData.
+	 */
+	Font* newFont(FileData& data, int size);
+	Font* newFont(FileData& data);
+
 	/**
 	 * Creates a new pixel font at the given size.
 	 *
@@ -298,6 +325,29 @@ class graphics {
 	graphics& draw(Image* image, Quad quad, int x, int y);
 	graphics& draw(Image* image, Quad quad);
 
+	/**
+	 * Draws an image at the given position, with the given angle, zoom, and origin.
+	 *
+	 * @param image The image to draw on the screen.
+	 * @param position The position to draw the object.
+	 * @param r (0) Orientation (radians).
+	 * @param scale (1, 1) Scale factor.
+	 * @param origin (0, 0) Origin offset.
+	 */
+	graphics& draw(Image* image, const Vector2& position, float r, const Vector2& scale, const Vector2& origin);
+	graphics& draw(Image* image, const Vector2& position, float r, const Vector2& scale);
+	graphics& draw(Image* image, const Vector2& position, float r);
+	graphics& draw(Image* image, const Vector2& position);
+
+	/**
+	 * Draws an image on screen at the given position, using the given Quad as a source.
+	 *
+	 * @param image The image to draw on the screen.
+	 * @param quad The source quad of the image.
+	 * @param position The position to draw the object.
+	 */
+	graphics& draw(Image* image, Quad quad, const Vector2& position);
+
 	/**
 	 * Draws an arc.
 	 *
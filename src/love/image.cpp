@@ -17,6 +17,16 @@ Image* image::newImageData(const std::string& filename) {
 	return NULL;
 }
 
+Image* image::newImageData(FileData& data) {
+	Image* image = new Image(data);
+	if (image->loaded()) {
+		m_images.push_back(image);
+		return image;
+	}
+	delete image;
+	return NULL;
+}
+
 bool image::load() {
 	return true;
 }
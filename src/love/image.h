@@ -2,10 +2,12 @@
 #define SRC_LOVE_IMAGE_H_
 
 #include "Types/Graphics/Image.h"
+#include "Types/FileSystem/FileData.h"
 #include <string>
 #include <list>
 
 using love::Types::Graphics::Image;
+using love::Types::FileSystem::FileData;
 
 namespace love {
 
@@ -32,6 +34,11 @@ class image {
 	 */
 	Image* newImageData(const std::string& filename);
 
+	/**
+	 * Creates a new ImageData object from the contents of a FileData, without reading the file again.
+	 */
+	Image* newImageData(FileData& data);
+
 	private:
 	std::list<Image*> m_images;
 };
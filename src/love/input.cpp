@@ -0,0 +1,126 @@
+#include "input.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "pntr_app.h"
+#include "../ChaiLove.h"
+
+namespace love {
+
+int input::bind(const std::string& action, const std::string& device, const std::string& button) {
+	return bind(action, device, button, 0);
+}
+
+int input::bind(const std::string& action, const std::string& device, const std::string& button, int joystick) {
+	ChaiLove* app = ChaiLove::getInstance();
+
+	// Resolve the button name once, when binding.
+	Binding binding;
+	binding.joystick = joystick;
+	if (device == "key" || device == "keyboard") {
+		binding.device = DEVICE_KEY;
+		binding.button = app->keyboard.getScancodeFromKey(button);
+	} else if (device == "gamepad" || device == "joystick") {
+		binding.device = DEVICE_GAMEPAD;
+		binding.button = app->joystick.getButtonKey(button);
+	} else if (device == "mouse") {
+		binding.device = DEVICE_MOUSE;
+		binding.button = app->mouse.getButtonKey(button);
+	} else {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [input] Unknown device %s for action %s.", device.c_str(), action.c_str());
+		return -1;
+	}
+	if (binding.button <= 0) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [input] Unknown %s button '%s' for action %s.", device.c_str(), button.c_str(), action.c_str());
+		return -1;
+	}
+
+	// Find or create the action ID.
+	std::map<std::string, int>::iterator found = m_actions.find(action);
+	if (found == m_actions.end()) {
+		int id = static_cast<int>(m_actions.size());
+		found = m_actions.insert(std::pair<std::string, int>(action, id)).first;
+		m_state.resize(id + 1);
+	}
+	binding.action = found->second;
+	m_bindings.push_back(binding);
+	return binding.action;
+}
+
+bool input::unbind(const std::string& action) {
+	int id = getAction(action);
+	if (id < 0) {
+		return false;
+	}
+	for (std::vector<Binding>::iterator it = m_bindings.begin(); it != m_bindings.end();) {
+		if (it->action == id) {
+			it = m_bindings.erase(it);
+		} else {
+			++it;
+		}
+	}
+	return true;
+}
+
+int input::getAction(const std::string& action) {
+	std::map<std::string, int>::iterator found = m_actions.find(action);
+	if (found == m_actions.end()) {
+		return -1;
+	}
+	return found->second;
+}
+
+bool input::isDown(int action) {
+	return m_state.isDown(action);
+}
+
+bool input::isDown(const std::string& action) {
+	return isDown(getAction(action));
+}
+
+bool input::wasPressed(int action) {
+	return m_state.wasPressed(action);
+}
+
+bool input::wasPressed(const std::string& action) {
+	return wasPressed(getAction(action));
+}
+
+bool input::wasReleased(int action) {
+	return m_state.wasReleased(action);
+}
+
+bool input::wasReleased(const std::string& action) {
+	return wasReleased(getAction(action));
+}
+
+void input::update() {
+	// Always advance the state, so that actions released by unbinding them don't stay down.
+	m_state.next();
+	if (m_bindings.empty()) {
+		return;
+	}
+
+	ChaiLove* app = ChaiLove::getInstance();
+	for (const Binding& binding : m_bindings) {
+		bool down = false;
+		switch (binding.device) {
+			case DEVICE_KEY:
+				down = app->keyboard.getState().isDown(binding.button);
+				break;
+			case DEVICE_GAMEPAD:
+				down = app->joystick[binding.joystick] != NULL && app->joystick[binding.joystick]->getState().isDown(binding.button);
+				break;
+			case DEVICE_MOUSE:
+				down = app->mouse.isDown(binding.button);
+				break;
+		}
+		if (down) {
+			m_state.set(binding.action, true);
+		}
+	}
+}
+
+}  // namespace love
@@ -0,0 +1,121 @@
+#ifndef SRC_LOVE_INPUT_H_
+#define SRC_LOVE_INPUT_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Types/Input/ButtonState.h"
+
+using love::Types::Input::ButtonState;
+
+namespace love {
+
+/**
+ * Maps named actions to keys, gamepad buttons and mouse buttons.
+ *
+ * Actions are bound once, and resolve to integer IDs. The state of all actions is taken once per frame, so checking an action is a bit test rather than a lookup of the key or button names.
+ *
+ * @code
+ * global jump
+ *
+ * def load() {
+ *   jump = love.input.bind("jump", "key", " ")
+ *   love.input.bind("jump", "gamepad", "a")
+ *   love.input.bind("fire", "mouse", "left")
+ * }
+ *
+ * def update(dt) {
+ *   if (love.input.wasPressed(jump)) {
+ *     player.jump()
+ *   }
+ *   if (love.input.isDown("fire")) {
+ *     player.fire()
+ *   }
+ * }
+ * @endcode
+ */
+class input {
+	public:
+	/**
+	 * Binds an input to the given action.
+	 *
+	 * An action can have any number of inputs bound to it, and is down when any of them is down.
+	 *
+	 * @param action The name of the action.
+	 * @param device The type of input. Can be "key", "gamepad" or "mouse".
+	 * @param button The name of the key, gamepad button, or mouse button.
+	 * @param joystick (0) The index of the joystick, for gamepad buttons.
+	 *
+	 * @return The ID of the action, or -1 if the input is unknown.
+	 */
+	int bind(const std::string& action, const std::string& device, const std::string& button, int joystick);
+	int bind(const std::string& action, const std::string& device, const std::string& button);
+
+	/**
+	 * Removes all the inputs bound to the given action.
+	 *
+	 * @return True if the action existed.
+	 */
+	bool unbind(const std::string& action);
+
+	/**
+	 * Gets the ID of the given action.
+	 *
+	 * @return The action ID, or -1 if the action has not been bound.
+	 */
+	int getAction(const std::string& action);
+
+	/**
+	 * Checks whether the given action is down.
+	 *
+	 * @param action The action ID, or name.
+	 *
+	 * @return True if any of the inputs bound to the action are down.
+	 */
+	bool isDown(int action);
+	bool isDown(const std::string& action);
+
+	/**
+	 * Checks whether the given action went down this frame.
+	 *
+	 * @param action The action ID, or name.
+	 */
+	bool wasPressed(int action);
+	bool wasPressed(const std::string& action);
+
+	/**
+	 * Checks whether the given action was released this frame.
+	 *
+	 * @param action The action ID, or name.
+	 */
+	bool wasReleased(int action);
+	bool wasReleased(const std::string& action);
+
+	/**
+	 * Takes the state of all the actions for the new frame.
+	 */
+	void update();
+
+	private:
+	enum Device {
+		DEVICE_KEY,
+		DEVICE_GAMEPAD,
+		DEVICE_MOUSE
+	};
+
+	struct Binding {
+		int action;
+		Device device;
+		int button;
+		int joystick;
+	};
+
+	std::map<std::string, int> m_actions;
+	std::vector<Binding> m_bindings;
+	ButtonState m_state;
+};
+
+}  // namespace love
+
+#endif  // SRC_LOVE_INPUT_H_
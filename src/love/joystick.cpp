@@ -1,5 +1,6 @@
 #include "joystick.h"
 #include "pntr_app.h"
+#include <map>
 #include <string>
 #include <vector>
 #include <libretro.h>
@@ -49,6 +50,38 @@ bool joystick::isDown(int joystick, const std::string& button) {
 	return m_joysticks[joystick]->isDown(button);
 }
 
+bool joystick::wasPressed(int joystick, int button) {
+	Joystick* pad = (*this)[joystick];
+	return pad != NULL && pad->wasPressed(button);
+}
+
+bool joystick::wasPressed(int joystick, const std::string& button) {
+	return wasPressed(joystick, getButtonKey(button));
+}
+
+bool joystick::wasReleased(int joystick, int button) {
+	Joystick* pad = (*this)[joystick];
+	return pad != NULL && pad->wasReleased(button);
+}
+
+bool joystick::wasReleased(int joystick, const std::string& button) {
+	return wasReleased(joystick, getButtonKey(button));
+}
+
+ButtonState* joystick::getState(int joystick) {
+	Joystick* pad = (*this)[joystick];
+	if (pad == NULL) {
+		return NULL;
+	}
+	return &pad->getState();
+}
+
+void joystick::update() {
+	for (Joystick* pad : m_joysticks) {
+		pad->update();
+	}
+}
+
 Joystick* joystick::operator[](int joystick) {
 	if (joystick < 0 || joystick >= getJoystickCount()) {
 		return NULL;
@@ -91,47 +124,33 @@ std::string joystick::getButtonName(int key) {
 }
 
 int joystick::getButtonKey(const std::string& name) {
-	// TODO: Build a pair map of the buttons so this is faster
-	if (name == "a") {
-		return PNTR_APP_GAMEPAD_BUTTON_A;
-	}
-	if (name == "b") {
-		return PNTR_APP_GAMEPAD_BUTTON_B;
-	}
-	if (name == "x") {
-		return PNTR_APP_GAMEPAD_BUTTON_X;
-	}
-	if (name == "y") {
-		return PNTR_APP_GAMEPAD_BUTTON_Y;
-	}
-	if (name == "select" || name == "back") {
-		return PNTR_APP_GAMEPAD_BUTTON_SELECT;
-	}
-	if (name == "start") {
-		return PNTR_APP_GAMEPAD_BUTTON_START;
-	}
-	if (name == "guide") {
-		return PNTR_APP_GAMEPAD_BUTTON_MENU;
-	}
-	if (name == "l1" || name == "leftshoulder") {
-		return PNTR_APP_GAMEPAD_BUTTON_LEFT_SHOULDER;
-	}
-	if (name == "r1" || name == "rightshoulder") {
-		return PNTR_APP_GAMEPAD_BUTTON_RIGHT_SHOULDER;
-	}
-	if (name == "up" || name == "dpup") {
-		return PNTR_APP_GAMEPAD_BUTTON_UP;
-	}
-	if (name == "down" || name == "dpdown") {
-		return PNTR_APP_GAMEPAD_BUTTON_DOWN;
-	}
-	if (name == "left" || name == "dpleft") {
-		return PNTR_APP_GAMEPAD_BUTTON_LEFT;
-	}
-	if (name == "right" || name == "dpright") {
-		return PNTR_APP_GAMEPAD_BUTTON_RIGHT;
-	}
-	return -1;
+	static const std::map<std::string, int> buttons = {
+		{"a", PNTR_APP_GAMEPAD_BUTTON_A},
+		{"b", PNTR_APP_GAMEPAD_BUTTON_B},
+		{"x", PNTR_APP_GAMEPAD_BUTTON_X},
+		{"y", PNTR_APP_GAMEPAD_BUTTON_Y},
+		{"select", PNTR_APP_GAMEPAD_BUTTON_SELECT},
+		{"back", PNTR_APP_GAMEPAD_BUTTON_SELECT},
+		{"start", PNTR_APP_GAMEPAD_BUTTON_START},
+		{"guide", PNTR_APP_GAMEPAD_BUTTON_MENU},
+		{"l1", PNTR_APP_GAMEPAD_BUTTON_LEFT_SHOULDER},
+		{"leftshoulder", PNTR_APP_GAMEPAD_BUTTON_LEFT_SHOULDER},
+		{"r1", PNTR_APP_GAMEPAD_BUTTON_RIGHT_SHOULDER},
+		{"rightshoulder", PNTR_APP_GAMEPAD_BUTTON_RIGHT_SHOULDER},
+		{"up", PNTR_APP_GAMEPAD_BUTTON_UP},
+		{"dpup", PNTR_APP_GAMEPAD_BUTTON_UP},
+		{"down", PNTR_APP_GAMEPAD_BUTTON_DOWN},
+		{"dpdown", PNTR_APP_GAMEPAD_BUTTON_DOWN},
+		{"left", PNTR_APP_GAMEPAD_BUTTON_LEFT},
+		{"dpleft", PNTR_APP_GAMEPAD_BUTTON_LEFT},
+		{"right", PNTR_APP_GAMEPAD_BUTTON_RIGHT},
+		{"dpright", PNTR_APP_GAMEPAD_BUTTON_RIGHT}
+	};
+	std::map<std::string, int>::const_iterator found = buttons.find(name);
+	if (found == buttons.end()) {
+		return -1;
+	}
+	return found->second;
 }
 
 }  // namespace love
@@ -8,6 +8,7 @@
 #include "pntr_app.h"
 
 using love::Types::Input::Joystick;
+using love::Types::Input::ButtonState;
 
 namespace love {
 
@@ -64,6 +65,49 @@ class joystick {
 	 */
 	bool isDown(int joystick, const std::string& button);
 
+	/**
+	 * Checks if a button went down on a joystick since the previous frame.
+	 *
+	 * @param joystick The joystick to be checked.
+	 * @param button The button to be checked.
+	 *
+	 * @return True if the joystick button was just pressed.
+	 */
+	bool wasPressed(int joystick, int button);
+	bool wasPressed(int joystick, const std::string& button);
+
+	/**
+	 * Checks if a button went up on a joystick since the previous frame.
+	 *
+	 * @param joystick The joystick to be checked.
+	 * @param button The button to be checked.
+	 *
+	 * @return True if the joystick button was just released.
+	 */
+	bool wasReleased(int joystick, int button);
+	bool wasReleased(int joystick, const std::string& button);
+
+	/**
+	 * Gets the state of all buttons of a joystick for the current and the previous frame.
+	 *
+	 * @param joystick The joystick index.
+	 *
+	 * @return The state of the joystick buttons, or NULL if the joystick does not exist.
+	 *
+	 * @code
+	 * var pad = love.joystick.getState(0)
+	 * if (pad.wasPressed(love.joystick.getButtonKey("a"))) {
+	 *   player.jump()
+	 * }
+	 * @endcode
+	 */
+	ButtonState* getState(int joystick);
+
+	/**
+	 * Takes the state of all joystick buttons for the current frame.
+	 */
+	void update();
+
 	/**
 	 * Retrieve the given joystick.
 	 *
@@ -11,8 +11,13 @@ bool keyboard::isDown(int scancode) {
 }
 
 bool keyboard::isScancodeDown(int scancode) {
-	if (scancode > 0 && scancode < RETROK_LAST) {
-		return keys[scancode] != 0;
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->replay.isPlaying()) {
+		return app->replay.isKeyDown(scancode);
+	}
+
+	if (scancode > 0 && scancode < PNTR_APP_KEY_LAST) {
+		return pntr_app_key_down(app->app, (pntr_app_key)scancode);
 	}
 
 	return false;
@@ -22,10 +27,39 @@ bool keyboard::isDown(const std::string& key) {
 	return isDown(getScancodeFromKey(key));
 }
 
+bool keyboard::wasPressed(int scancode) {
+	return m_state.wasPressed(scancode);
+}
+
+bool keyboard::wasPressed(const std::string& key) {
+	return wasPressed(getScancodeFromKey(key));
+}
+
+bool keyboard::wasReleased(int scancode) {
+	return m_state.wasReleased(scancode);
+}
+
+bool keyboard::wasReleased(const std::string& key) {
+	return wasReleased(getScancodeFromKey(key));
+}
+
+ButtonState& keyboard::getState() {
+	return m_state;
+}
+
+void keyboard::update() {
+	m_state.next();
+	for (int scancode : m_scancodes) {
+		if (isScancodeDown(scancode)) {
+			m_state.set(scancode, true);
+		}
+	}
+}
+
 bool keyboard::load() {
 	// Initialize the scancode to key mappings with empty strings.
 	int i;
-	for (i = 0; i < RETROK_LAST; i++) {
+	for (i = 0; i < PNTR_APP_KEY_LAST; i++) {
 		scancodeToKey[i] = "";
 	}
 
@@ -154,17 +188,23 @@ bool keyboard::load() {
 	scancodeToKey[PNTR_APP_KEY_MENU] = "menu";
 
 	// Initialize the key to scancode mappings.
-	for (i = 0; i < RETROK_LAST; i++) {
+	for (i = 0; i < PNTR_APP_KEY_LAST; i++) {
 		if (!scancodeToKey[i].empty()) {
 			keyToScancode.insert(std::pair<std::string, int> (scancodeToKey[i], i));
+			m_scancodes.push_back(i);
 		}
 	}
+	m_state.resize(PNTR_APP_KEY_LAST);
 
 	return true;
 }
 
 int keyboard::getScancodeFromKey(const std::string& name) {
-	return keyToScancode[name];
+	std::map<std::string, int>::iterator found = keyToScancode.find(name);
+	if (found == keyToScancode.end()) {
+		return PNTR_APP_KEY_INVALID;
+	}
+	return found->second;
 }
 
 std::string keyboard::getKeyFromScancode(int scancode) {
@@ -3,10 +3,14 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "libretro.h"
 
 #include "pntr_app.h"
+#include "Types/Input/ButtonState.h"
+
+using love::Types::Input::ButtonState;
 
 namespace love {
 /**
@@ -43,6 +47,49 @@ class keyboard {
 	 */
 	bool isScancodeDown(int scancode);
 
+	/**
+	 * Checks whether a certain key went down since the previous frame.
+	 *
+	 * @param key The key to check.
+	 *
+	 * @return True if the key was just pressed, false if not.
+	 *
+	 * @see love.keyboard.wasReleased
+	 */
+	bool wasPressed(const std::string& key);
+	bool wasPressed(int scancode);
+
+	/**
+	 * Checks whether a certain key went up since the previous frame.
+	 *
+	 * @param key The key to check.
+	 *
+	 * @return True if the key was just released, false if not.
+	 *
+	 * @see love.keyboard.wasPressed
+	 */
+	bool wasReleased(const std::string& key);
+	bool wasReleased(int scancode);
+
+	/**
+	 * Gets the state of all keys for the current and the previous frame, indexed by scancode.
+	 *
+	 * The state is taken once per frame, before update() is called.
+	 *
+	 * @return The state of the keyboard.
+	 *
+	 * @code
+	 * var keys = love.keyboard.getState()
+	 * var packed = keys.getCurrent()
+	 * @endcode
+	 */
+	ButtonState& getState();
+
+	/**
+	 * Takes the state of all keys for the current frame.
+	 */
+	void update();
+
 	/**
 	 * Retrieve a scancode from the given key.
 	 *
@@ -63,6 +110,10 @@ class keyboard {
 
 	void eventKeyPressed(int key);
 	void eventKeyReleased(int key);
+
+	private:
+	ButtonState m_state;
+	std::vector<int> m_scancodes;
 };
 
 }  // namespace love
@@ -1,4 +1,5 @@
 #include "math.h"
+#include "../ChaiLove.h"
 
 namespace love {
 
@@ -40,6 +41,8 @@ math& math::setRandomSeed(int min, int max) {
 }
 
 math& math::setRandomSeed(int seed) {
+	// Let the replay record the seed, or swap in the recorded one.
+	seed = ::ChaiLove::getInstance()->replay.filterSeed(seed);
 	pntr_app_random_set_seed(app, seed);
 	return *this;
 }
@@ -19,19 +19,29 @@ bool mouse::load(pntr_app* app) {
 }
 
 float mouse::getX() {
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->replay.isPlaying()) {
+		return app->replay.getMouseX();
+	}
 	return pntr_app_mouse_x(m_app);
 }
 
 float mouse::getY() {
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->replay.isPlaying()) {
+		return app->replay.getMouseY();
+	}
 	return pntr_app_mouse_y(m_app);
 }
 
 bool mouse::isDown(int button) {
+	ChaiLove* app = ChaiLove::getInstance();
+	bool replaying = app->replay.isPlaying();
 	if (button == RETRO_DEVICE_ID_MOUSE_WHEELUP) {
-		return pntr_app_mouse_wheel(m_app) < 0;
+		return (replaying ? app->replay.getMouseWheel() : pntr_app_mouse_wheel(m_app)) < 0;
 	}
 	else if (button == RETRO_DEVICE_ID_MOUSE_WHEELDOWN) {
-		return pntr_app_mouse_wheel(m_app) > 0;
+		return (replaying ? app->replay.getMouseWheel() : pntr_app_mouse_wheel(m_app)) > 0;
 	}
 	else if (button < PNTR_APP_MOUSE_BUTTON_FIRST) {
 		return false;
@@ -40,7 +50,10 @@ bool mouse::isDown(int button) {
 		return false;
 	}
 
-	return pntr_app_key_down(m_app, (pntr_app_key)button);
+	if (replaying) {
+		return app->replay.isMouseButtonDown(button);
+	}
+	return pntr_app_mouse_button_down(m_app, (pntr_app_mouse_button)button);
 }
 bool mouse::isDown(const std::string& button) {
 	return isDown(getButtonKey(button));
@@ -95,7 +108,7 @@ void mouse::wheelmoved(int x, int y) {
 }
 
 Point mouse::getPosition() {
-	return Point(pntr_app_mouse_x(m_app), pntr_app_mouse_y(m_app));
+	return Point(getX(), getY());
 }
 
 }  // namespace love
@@ -0,0 +1,435 @@
+#include "replay.h"
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+#include "physfs.h"
+#include "compat/zlib.h"
+#include "../ChaiLove.h"
+
+using ::ChaiLove;
+
+/**
+ * The entry type used to store a random seed change in the log.
+ */
+#define CHAILOVE_REPLAY_ENTRY_SEED 0xFF
+
+/**
+ * The version of the binary replay log format.
+ */
+#define CHAILOVE_REPLAY_VERSION 1
+
+namespace love {
+
+replay::~replay() {
+	unload();
+}
+
+void replay::unload() {
+	// Make sure any recording in progress makes it to the disk.
+	if (m_recording) {
+		stop();
+	}
+	m_playing = false;
+}
+
+bool replay::record(const std::string& filename) {
+	if (filename.empty()) {
+		pntr_app_log(PNTR_APP_LOG_ERROR, "[ChaiLove] [replay] record() was called without a filename");
+		return false;
+	}
+	stop();
+
+	m_filename = filename;
+	m_log.clear();
+	m_frameLog.clear();
+	m_frameEntries = 0;
+	m_frame = 0;
+	m_mismatches = 0;
+
+	// Header: magic, version and the random seed at the start of the recording.
+	m_log.append("CLRP", 4);
+	writeByte(m_log, CHAILOVE_REPLAY_VERSION);
+	int seed = ChaiLove::getInstance()->math.getRandomSeed();
+	writeInt(m_log, (unsigned int)seed);
+
+	// The generator has moved on since the seed was set, so restart it from the seed, like play() does.
+	ChaiLove::getInstance()->math.setRandomSeed(seed);
+
+	m_recording = true;
+	pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [replay] Recording input to %s", filename.c_str());
+	return true;
+}
+
+bool replay::play(const std::string& filename) {
+	stop();
+
+	PHYSFS_File* file = PHYSFS_openRead(filename.c_str());
+	if (file == NULL) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [replay] Could not open %s", filename.c_str());
+		return false;
+	}
+	PHYSFS_sint64 size = PHYSFS_fileLength(file);
+	if (size < 9) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [replay] %s is not a replay log", filename.c_str());
+		PHYSFS_close(file);
+		return false;
+	}
+	m_log.resize((size_t)size);
+	PHYSFS_sint64 bytesRead = PHYSFS_readBytes(file, &m_log[0], (PHYSFS_uint64)size);
+	PHYSFS_close(file);
+	if (bytesRead != size || m_log.compare(0, 4, "CLRP") != 0) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [replay] %s is not a replay log", filename.c_str());
+		m_log.clear();
+		return false;
+	}
+
+	m_position = 4;
+	int version = readByte();
+	if (version != CHAILOVE_REPLAY_VERSION) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [replay] Unsupported replay log version %d", version);
+		m_log.clear();
+		return false;
+	}
+
+	// Start from the same random seed that the recording started with.
+	ChaiLove::getInstance()->math.setRandomSeed((int)readInt());
+
+	// Reset the input state.
+	memset(m_keys, 0, sizeof(m_keys));
+	memset(m_gamepadButtons, 0, sizeof(m_gamepadButtons));
+	m_mouseButtons = 0;
+	m_mouseX = m_mouseY = m_mouseWheel = 0;
+
+	m_filename = filename;
+	m_frame = 0;
+	m_mismatches = 0;
+	m_playing = true;
+	pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [replay] Playing input from %s", filename.c_str());
+	return true;
+}
+
+bool replay::stop() {
+	if (m_playing) {
+		m_playing = false;
+		m_log.clear();
+		pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [replay] Played %d frames of %s with %d mismatched frames", m_frame, m_filename.c_str(), m_mismatches);
+		return true;
+	}
+
+	if (!m_recording) {
+		return false;
+	}
+	m_recording = false;
+
+	// Write through love.filesystem, so that it knows the file has changed.
+	int size = static_cast<int>(m_log.size());
+	bool written = ChaiLove::getInstance()->filesystem.write(m_filename, m_log);
+	m_log.clear();
+	if (!written) {
+		pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [replay] Failed to write %s", m_filename.c_str());
+		return false;
+	}
+	pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [replay] Recorded %d frames to %s (%d bytes)", m_frame, m_filename.c_str(), size);
+	return true;
+}
+
+bool replay::isRecording() {
+	return m_recording;
+}
+
+bool replay::isPlaying() {
+	return m_playing;
+}
+
+int replay::getFrame() {
+	return m_frame;
+}
+
+int replay::getMismatches() {
+	return m_mismatches;
+}
+
+bool replay::isInputEvent(pntr_app_event* event) {
+	switch (event->type) {
+		case PNTR_APP_EVENTTYPE_KEY_DOWN:
+		case PNTR_APP_EVENTTYPE_KEY_UP:
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
+		case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
+		case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
+			return true;
+		default:
+			return false;
+	}
+}
+
+void replay::recordEvent(pntr_app_event* event) {
+	// Each frame stores its number of entries in two bytes.
+	if (!m_recording || !isInputEvent(event) || m_frameEntries >= 0xFFFF) {
+		return;
+	}
+
+	writeByte(m_frameLog, (unsigned char)event->type);
+	switch (event->type) {
+		case PNTR_APP_EVENTTYPE_KEY_DOWN:
+		case PNTR_APP_EVENTTYPE_KEY_UP:
+			writeShort(m_frameLog, event->key);
+			break;
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
+			writeByte(m_frameLog, (unsigned char)event->mouseButton);
+			writeShort(m_frameLog, event->mouseX);
+			writeShort(m_frameLog, event->mouseY);
+			break;
+		case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
+			writeShort(m_frameLog, event->mouseX);
+			writeShort(m_frameLog, event->mouseY);
+			writeShort(m_frameLog, event->mouseDeltaX);
+			writeShort(m_frameLog, event->mouseDeltaY);
+			break;
+		case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
+			writeShort(m_frameLog, event->mouseWheel);
+			break;
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
+			writeByte(m_frameLog, (unsigned char)event->gamepad);
+			writeByte(m_frameLog, (unsigned char)event->gamepadButton);
+			break;
+		default:
+			break;
+	}
+	m_frameEntries++;
+}
+
+int replay::filterSeed(int seed) {
+	if (m_recording) {
+		writeByte(m_frameLog, CHAILOVE_REPLAY_ENTRY_SEED);
+		writeInt(m_frameLog, (unsigned int)seed);
+		m_frameEntries++;
+	} else if (m_playing) {
+		if (m_frameSeed < m_frameSeeds.size()) {
+			return m_frameSeeds[m_frameSeed++];
+		}
+		pntr_app_log_ex(PNTR_APP_LOG_WARNING, "[ChaiLove] [replay] Unrecorded setRandomSeed() call on frame %d", m_frame);
+	}
+	return seed;
+}
+
+std::vector<pntr_app_event>& replay::beginFrame() {
+	m_frameEvents.clear();
+	m_frameSeeds.clear();
+	m_frameSeed = 0;
+	if (!m_playing) {
+		return m_frameEvents;
+	}
+
+	// Stop once the whole log has been played back.
+	if (m_position >= m_log.size()) {
+		stop();
+		return m_frameEvents;
+	}
+
+	unsigned int deltaBits = readInt();
+	memcpy(&m_delta, &deltaBits, sizeof(m_delta));
+	m_mouseWheel = 0;
+
+	int entries = readShort() & 0xFFFF;
+	for (int i = 0; i < entries; i++) {
+		unsigned char type = readByte();
+		if (type == CHAILOVE_REPLAY_ENTRY_SEED) {
+			m_frameSeeds.push_back((int)readInt());
+			continue;
+		}
+
+		pntr_app_event event;
+		memset(&event, 0, sizeof(event));
+		event.type = (pntr_app_event_type)type;
+		switch (event.type) {
+			case PNTR_APP_EVENTTYPE_KEY_DOWN:
+			case PNTR_APP_EVENTTYPE_KEY_UP:
+				event.key = (pntr_app_key)readShort();
+				break;
+			case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
+			case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
+				event.mouseButton = (pntr_app_mouse_button)readByte();
+				event.mouseX = readShort();
+				event.mouseY = readShort();
+				break;
+			case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
+				event.mouseX = readShort();
+				event.mouseY = readShort();
+				event.mouseDeltaX = readShort();
+				event.mouseDeltaY = readShort();
+				break;
+			case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
+				event.mouseWheel = readShort();
+				break;
+			case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
+			case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
+				event.gamepad = readByte();
+				event.gamepadButton = (pntr_app_gamepad_button)readByte();
+				break;
+			default:
+				pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [replay] Corrupt entry on frame %d, stopping playback", m_frame);
+				stop();
+				m_frameEvents.clear();
+				return m_frameEvents;
+		}
+		updateState(event);
+		m_frameEvents.push_back(event);
+	}
+	m_hash = readInt();
+
+	return m_frameEvents;
+}
+
+void replay::endFrame(pntr_image* screen, float delta) {
+	if (m_recording) {
+		unsigned int deltaBits;
+		memcpy(&deltaBits, &delta, sizeof(deltaBits));
+		writeInt(m_log, deltaBits);
+		writeShort(m_log, m_frameEntries);
+		m_log.append(m_frameLog);
+		writeInt(m_log, hashScreen(screen));
+		m_frameLog.clear();
+		m_frameEntries = 0;
+		m_frame++;
+	} else if (m_playing) {
+		unsigned int hash = hashScreen(screen);
+		if (hash != m_hash) {
+			if (m_mismatches == 0) {
+				pntr_app_log_ex(PNTR_APP_LOG_WARNING, "[ChaiLove] [replay] Frame %d differs from the recording", m_frame);
+			}
+			m_mismatches++;
+		}
+		m_frame++;
+	}
+}
+
+float replay::getDelta() {
+	return m_delta;
+}
+
+bool replay::isKeyDown(int key) {
+	if (key <= 0 || key >= PNTR_APP_KEY_LAST) {
+		return false;
+	}
+	return m_keys[key] != 0;
+}
+
+bool replay::isGamepadButtonDown(int gamepad, int button) {
+	if (gamepad < 0 || gamepad >= 4 || button < 0 || button >= 32) {
+		return false;
+	}
+	return (m_gamepadButtons[gamepad] & (1u << button)) != 0;
+}
+
+bool replay::isMouseButtonDown(int button) {
+	if (button < 0 || button >= 32) {
+		return false;
+	}
+	return (m_mouseButtons & (1u << button)) != 0;
+}
+
+int replay::getMouseX() {
+	return m_mouseX;
+}
+
+int replay::getMouseY() {
+	return m_mouseY;
+}
+
+int replay::getMouseWheel() {
+	return m_mouseWheel;
+}
+
+void replay::updateState(const pntr_app_event& event) {
+	switch (event.type) {
+		case PNTR_APP_EVENTTYPE_KEY_DOWN:
+		case PNTR_APP_EVENTTYPE_KEY_UP:
+			if (event.key > 0 && event.key < PNTR_APP_KEY_LAST) {
+				m_keys[event.key] = event.type == PNTR_APP_EVENTTYPE_KEY_DOWN;
+			}
+			break;
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
+			m_mouseButtons |= 1u << (event.mouseButton & 31);
+			m_mouseX = event.mouseX;
+			m_mouseY = event.mouseY;
+			break;
+		case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
+			m_mouseButtons &= ~(1u << (event.mouseButton & 31));
+			m_mouseX = event.mouseX;
+			m_mouseY = event.mouseY;
+			break;
+		case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
+			m_mouseX = event.mouseX;
+			m_mouseY = event.mouseY;
+			break;
+		case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
+			m_mouseWheel += event.mouseWheel;
+			break;
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
+			m_gamepadButtons[event.gamepad & 3] |= 1u << (event.gamepadButton & 31);
+			break;
+		case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
+			m_gamepadButtons[event.gamepad & 3] &= ~(1u << (event.gamepadButton & 31));
+			break;
+		default:
+			break;
+	}
+}
+
+unsigned int replay::hashScreen(pntr_image* screen) {
+	if (screen == NULL || screen->data == NULL) {
+		return 0;
+	}
+	uLong hash = crc32(0L, Z_NULL, 0);
+	for (int y = 0; y < screen->height; y++) {
+		const Bytef* row = (const Bytef*)screen->data + (size_t)y * (size_t)screen->pitch;
+		hash = crc32(hash, row, (uInt)(screen->width * sizeof(pntr_color)));
+	}
+	return (unsigned int)hash;
+}
+
+void replay::writeByte(std::string& buffer, unsigned char value) {
+	buffer.push_back((char)value);
+}
+
+void replay::writeShort(std::string& buffer, int value) {
+	writeByte(buffer, (unsigned char)(value & 0xFF));
+	writeByte(buffer, (unsigned char)((value >> 8) & 0xFF));
+}
+
+void replay::writeInt(std::string& buffer, unsigned int value) {
+	writeByte(buffer, (unsigned char)(value & 0xFF));
+	writeByte(buffer, (unsigned char)((value >> 8) & 0xFF));
+	writeByte(buffer, (unsigned char)((value >> 16) & 0xFF));
+	writeByte(buffer, (unsigned char)((value >> 24) & 0xFF));
+}
+
+unsigned char replay::readByte() {
+	if (m_position >= m_log.size()) {
+		return 0;
+	}
+	return (unsigned char)m_log[m_position++];
+}
+
+int replay::readShort() {
+	int low = readByte();
+	int high = readByte();
+	return (short)(low | (high << 8));
+}
+
+unsigned int replay::readInt() {
+	unsigned int value = readByte();
+	value |= (unsigned int)readByte() << 8;
+	value |= (unsigned int)readByte() << 16;
+	value |= (unsigned int)readByte() << 24;
+	return value;
+}
+
+}  // namespace love
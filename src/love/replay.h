@@ -0,0 +1,162 @@
+#ifndef SRC_LOVE_REPLAY_H_
+#define SRC_LOVE_REPLAY_H_
+
+#include <string>
+#include <vector>
+
+#include "pntr_app.h"
+
+namespace love {
+
+/**
+ * Records and replays the per-frame input, so that the same gameplay can be run deterministically.
+ *
+ * While recording, every input event, the frame delta time, any random seed changes, and a hash of the rendered frame are stored in a compact binary log. While playing the log back, live input is ignored, the recorded input is fed into the game instead, and each rendered frame is compared against the recorded hash to catch nondeterminism.
+ *
+ * @code
+ * def load() {
+ *   // Record the input until love.replay.stop() is called, or the game closes.
+ *   love.replay.record("gameplay.replay")
+ * }
+ * @endcode
+ *
+ * @code
+ * def load() {
+ *   // Play back a previously recorded log from the save directory.
+ *   love.replay.play("/libretro/saves/gameplay.replay")
+ * }
+ * @endcode
+ */
+class replay {
+	public:
+	~replay();
+
+	/**
+	 * Starts recording the input into the given file in the save directory.
+	 *
+	 * The random seed is captured when recording starts. The log is written when the recording is stopped, or when the game closes.
+	 *
+	 * @param filename The name of the file to write the log to.
+	 *
+	 * @return True if the recording started.
+	 *
+	 * @see stop
+	 */
+	bool record(const std::string& filename);
+
+	/**
+	 * Starts playing back the input log from the given file.
+	 *
+	 * @param filename The path to the log that was previously recorded.
+	 *
+	 * @return True if the log was loaded and will be played back.
+	 *
+	 * @see stop
+	 */
+	bool play(const std::string& filename);
+
+	/**
+	 * Stops recording or playing back. When recording, this will write the log file.
+	 *
+	 * @return True if the log was written, or the playback was stopped.
+	 */
+	bool stop();
+
+	/**
+	 * Whether or not input is currently being recorded.
+	 */
+	bool isRecording();
+
+	/**
+	 * Whether or not a recorded input log is currently being played back.
+	 */
+	bool isPlaying();
+
+	/**
+	 * Gets the number of frames that were recorded or played back.
+	 */
+	int getFrame();
+
+	/**
+	 * Gets the number of played back frames whose rendered output differed from the recording.
+	 */
+	int getMismatches();
+
+	void unload();
+
+	/**
+	 * Whether the given event is an input event that is handled by the replay.
+	 */
+	bool isInputEvent(pntr_app_event* event);
+
+	/**
+	 * Appends the given input event to the frame that is currently being recorded.
+	 */
+	void recordEvent(pntr_app_event* event);
+
+	/**
+	 * Stores a change to the random seed. While playing back, the recorded seed is returned instead.
+	 */
+	int filterSeed(int seed);
+
+	/**
+	 * Starts a new frame, returning the recorded input events that should be dispatched for it.
+	 */
+	std::vector<pntr_app_event>& beginFrame();
+
+	/**
+	 * Finishes the frame, hashing the rendered screen.
+	 */
+	void endFrame(pntr_image* screen, float delta);
+
+	/**
+	 * The recorded delta time of the frame being played back.
+	 */
+	float getDelta();
+
+	bool isKeyDown(int key);
+	bool isGamepadButtonDown(int gamepad, int button);
+	bool isMouseButtonDown(int button);
+	int getMouseX();
+	int getMouseY();
+	int getMouseWheel();
+
+	private:
+	void writeByte(std::string& buffer, unsigned char value);
+	void writeShort(std::string& buffer, int value);
+	void writeInt(std::string& buffer, unsigned int value);
+	unsigned char readByte();
+	int readShort();
+	unsigned int readInt();
+	void updateState(const pntr_app_event& event);
+	unsigned int hashScreen(pntr_image* screen);
+
+	bool m_recording = false;
+	bool m_playing = false;
+	std::string m_filename;
+	std::string m_log;
+	size_t m_position = 0;
+	int m_frame = 0;
+	int m_mismatches = 0;
+
+	// The entries of the frame being recorded, and the events of the frame being played back.
+	std::string m_frameLog;
+	int m_frameEntries = 0;
+	std::vector<pntr_app_event> m_frameEvents;
+	std::vector<int> m_frameSeeds;
+	size_t m_frameSeed = 0;
+	float m_delta = 0.0f;
+	unsigned int m_hash = 0;
+
+	// The input state that is rebuilt from the events while playing back.
+	unsigned char m_keys[PNTR_APP_KEY_LAST] = {};
+	unsigned int m_gamepadButtons[4] = {};
+	unsigned int m_mouseButtons = 0;
+	int m_mouseX = 0;
+	int m_mouseY = 0;
+	int m_mouseWheel = 0;
+};
+
+}  // namespace love
+
+#endif  // SRC_LOVE_REPLAY_H_
@@ -1,6 +1,8 @@
 #include "script.h"
 #include "../ChaiLove.h"
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
 
 #ifdef __HAVE_CHAISCRIPT__
 #include "chaiscript/extras/math.hpp"
@@ -16,17 +18,27 @@ using love::Types::Graphics::Point;
 using love::Types::Input::Joystick;
 //using love::Types::Graphics::Color;
 using love::Types::Input::Joystick;
+using love::Types::Input::ButtonState;
 using love::Types::Config::WindowConfig;
 using love::Types::Config::ModuleConfig;
 using love::Types::Audio::SoundData;
+using love::Types::FileSystem::File;
 using love::Types::FileSystem::FileData;
+using love::Types::FileSystem::FileRequest;
+using love::Types::FileSystem::LineIterator;
+using love::Types::Math::Vector2;
+using love::Types::ECS::World;
+using love::Types::Data::Struct;
+using love::Types::Data::StructType;
+using love::Types::Data::ByteData;
+using love::Types::Data::Compressor;
 using love::graphics;
 
 namespace love {
 
 std::string script::findModule(const std::string& filename) {
 	ChaiLove* app = ChaiLove::getInstance();
-	std::string possibilities[5] = {
+	std::string possibilities[3] = {
 		filename,
 		filename + ".chai",
 		// Allow loading lua files as ChaiScript?
@@ -37,8 +49,19 @@ std::string script::findModule(const std::string& filename) {
 		// filename + "/init.lua"
 	};
 	for (const std::string& possibility : possibilities) {
+		// Prefer a module precompiled with chailove-compile, unless its source was changed since.
+		if (possibility != filename) {
+			FileInfo compiled = app->filesystem.getInfo(possibility + "c");
+			if (compiled.type == "file") {
+				FileInfo source = app->filesystem.getInfo(possibility);
+				if (source.type != "file" || compiled.modtime >= source.modtime) {
+					return possibility + "c";
+				}
+			}
+		}
+
 		// Make sure the file exists and is a file.
-		if (app->filesystem.exists(possibility) && app->filesystem.isFile(possibility)) {
+		if (app->filesystem.isFile(possibility)) {
 			return possibility;
 		}
 	}
@@ -71,13 +94,41 @@ bool script::loadModule(const std::string& moduleName) {
 		return false;
 	}
 
-	// Run the script.
-	eval(contents, filename);
+	// Run the parsed script.
+	std::shared_ptr<chaiscript::AST_Node> ast = parseModule(contents, filename);
+	try {
+		chai.eval(*ast);
+	}
+	catch (const chaiscript::Boxed_Value& error) {
+		// Running a parsed tree wraps its errors, so unwrap them to be reported with their file and line, like eval() does.
+		if (error.get_type_info().bare_equal(chaiscript::user_type<chaiscript::exception::eval_error>())) {
+			throw chaiscript::boxed_cast<const chaiscript::exception::eval_error&>(error);
+		}
+		throw;
+	}
 	return true;
 	#endif
 	return false;
 }
 
+#ifdef __HAVE_CHAISCRIPT__
+std::shared_ptr<chaiscript::AST_Node> script::parseModule(const std::string& code, const std::string& filename) {
+	// Reuse the parsed tree if the module has not changed since it was last parsed.
+	size_t hash = std::hash<std::string>()(code);
+	std::map<std::string, ParsedModule>::iterator found = m_parsedmodules.find(filename);
+	if (found != m_parsedmodules.end() && found->second.hash == hash && found->second.size == code.size()) {
+		m_parsedmoduleHits++;
+		return found->second.ast;
+	}
+
+	// Replace possible problematic tabs, and parse the script.
+	std::string contents = replaceString(code, "\t", "  ");
+	std::shared_ptr<chaiscript::AST_Node> ast(m_parser.parse(contents, filename));
+	m_parsedmodules[filename] = ParsedModule{hash, code.size(), ast};
+	return ast;
+}
+#endif
+
 bool script::require(const std::string& moduleName) {
 	// Find what the cleansed module name is.
 	std::string noExtension = replaceString(replaceString(moduleName, ".chai", ""), ".lua", "");
@@ -133,16 +184,57 @@ void chailove_error_level(const std::string& message, int level) {
 	pntr_app_log(PNTR_APP_LOG_ERROR, message.c_str());
 }
 
+#ifdef __HAVE_CHAISCRIPT__
+namespace {
+
+/**
+ * The bindings of each module, along with the ModuleConfig flag that enables it, and its object in the love namespace.
+ */
+struct ModuleBinding {
+	const char* name;
+	bool ModuleConfig::* enabled;
+	void (script::*bind)();
+	chaiscript::Boxed_Value (*object)();
+};
+
+const ModuleBinding moduleBindings[] = {
+	{"audio", &ModuleConfig::audio, &script::registerAudio, []() { return var(std::ref(ChaiLove::getInstance()->audio)); }},
+	{"data", &ModuleConfig::data, &script::registerData, []() { return var(std::ref(ChaiLove::getInstance()->data)); }},
+	{"ecs", &ModuleConfig::ecs, &script::registerEcs, []() { return var(std::ref(ChaiLove::getInstance()->ecs)); }},
+	{"event", &ModuleConfig::event, &script::registerEvent, []() { return var(std::ref(ChaiLove::getInstance()->event)); }},
+	{"filesystem", NULL, &script::registerFilesystem, []() { return var(std::ref(ChaiLove::getInstance()->filesystem)); }},
+	{"font", &ModuleConfig::font, &script::registerFont, []() { return var(std::ref(ChaiLove::getInstance()->font)); }},
+	{"graphics", &ModuleConfig::graphics, &script::registerGraphics, []() { return var(std::ref(ChaiLove::getInstance()->graphics)); }},
+	{"image", &ModuleConfig::image, &script::registerImage, []() { return var(std::ref(ChaiLove::getInstance()->image)); }},
+	{"input", &ModuleConfig::input, &script::registerInput, []() { return var(std::ref(ChaiLove::getInstance()->input)); }},
+	{"joystick", &ModuleConfig::joystick, &script::registerJoystick, []() { return var(std::ref(ChaiLove::getInstance()->joystick)); }},
+	{"keyboard", &ModuleConfig::keyboard, &script::registerKeyboard, []() { return var(std::ref(ChaiLove::getInstance()->keyboard)); }},
+	{"math", &ModuleConfig::math, &script::registerMath, []() { return var(std::ref(ChaiLove::getInstance()->math)); }},
+	{"mouse", &ModuleConfig::mouse, &script::registerMouse, []() { return var(std::ref(ChaiLove::getInstance()->mouse)); }},
+	{"replay", &ModuleConfig::replay, &script::registerReplay, []() { return var(std::ref(ChaiLove::getInstance()->replay)); }},
+	{"sound", &ModuleConfig::sound, &script::registerSound, []() { return var(std::ref(ChaiLove::getInstance()->sound)); }},
+	{"system", &ModuleConfig::system, &script::registerSystem, []() { return var(std::ref(ChaiLove::getInstance()->system)); }},
+	{"timer", &ModuleConfig::timer, &script::registerTimer, []() { return var(std::ref(ChaiLove::getInstance()->timer)); }},
+	{"window", &ModuleConfig::window, &script::registerWindow, []() { return var(std::ref(ChaiLove::getInstance()->window)); }}
+};
+
+}  // namespace
+#endif
+
 script::script(const std::string& file) {
 	#ifdef __HAVE_CHAISCRIPT__
 	ChaiLove* app = ChaiLove::getInstance();
 
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::string timings;
+
 	// Override some of the global Lua functions
 	// https://www.lua.org/manual/5.4/manual.html#6.1
 	chai.add(fun(&chailove_print), "print");
 	chai.add(fun(&chailove_dofile), "dofile");
 	chai.add(fun(&chailove_error), "error");
 	chai.add(fun(&chailove_error_level), "error");
+	chai.add(fun(&script::require, this), "require");
 
 	// ChaiScript Standard Library Additions
 	// This adds some basic type definitions to ChaiScript.
@@ -152,6 +244,7 @@ script::script(const std::string& file) {
 	chai.add(bootstrap::standard_library::map_type<std::map<std::string, bool>>("StringBoolMap"));
 	chai.add(bootstrap::standard_library::map_type<std::map<std::string, int>>("StringIntMap"));
 	chai.add(bootstrap::standard_library::map_type<std::map<std::string, float>>("StringFloatMap"));
+	chai.add(vector_conversion<std::vector<std::string>>());
 
 	// ChaiScript_Extras: String Methods
 	auto stringmethods = chaiscript::extras::string_methods::bootstrap();
@@ -162,96 +255,13 @@ script::script(const std::string& file) {
 	chaiscript::bootstrap::standard_library::list_type<std::list<chaiscript::Boxed_Value> >("List", *listModule);
 	chai.add(listModule);
 
-	// Add the "love" namespace.
+	// Add the "love" namespace. Each module is added to it once it's registered, so that a disabled module is missing rather than unbound.
 	chai.register_namespace([](chaiscript::Namespace& love) {
-		ChaiLove* app = ChaiLove::getInstance();
-		love["audio"] = var(std::ref(app->audio));
-		love["config"] = var(std::ref(app->config));
-		love["data"] = var(std::ref(app->data));
-		love["event"] = var(std::ref(app->event));
-		love["filesystem"] = var(std::ref(app->filesystem));
-		love["font"] = var(std::ref(app->font));
-		love["graphics"] = var(std::ref(app->graphics));
-		love["image"] = var(std::ref(app->image));
-		love["joystick"] = var(std::ref(app->joystick));
-		love["keyboard"] = var(std::ref(app->keyboard));
-		love["math"] = var(std::ref(app->math));
-		love["mouse"] = var(std::ref(app->mouse));
-		love["sound"] = var(std::ref(app->sound));
-		love["system"] = var(std::ref(app->system));
-		love["timer"] = var(std::ref(app->timer));
-		love["window"] = var(std::ref(app->window));
+		love.set_explicit(true);
+		love["config"] = var(std::ref(ChaiLove::getInstance()->config));
 	},
 	"love");
 
-	// Quad Object.
-	chai.add(user_type<Quad>(), "Quad");
-	chai.add(constructor<Quad()>(), "Quad");
-	chai.add(fun(&Quad::x), "x");
-	chai.add(fun(&Quad::y), "y");
-	chai.add(fun(&Quad::width), "width");
-	chai.add(fun(&Quad::height), "height");
-	chai.add(fun(&Quad::sw), "sw");
-	chai.add(fun(&Quad::sh), "sh");
-
-	// Point Object.
-	chai.add(user_type<Point>(), "Point");
-	chai.add(fun(&Point::x), "x");
-	chai.add(fun(&Point::y), "y");
-	chai.add(constructor<Point()>(), "Point");
-	chai.add(constructor<Point(float)>(), "Point");
-	chai.add(constructor<Point(float, float)>(), "Point");
-
-	// FileInfo Object.
-	chai.add(user_type<FileInfo>(), "FileInfo");
-	chai.add(fun(&FileInfo::type), "type");
-	chai.add(fun(&FileInfo::size), "size");
-	chai.add(fun(&FileInfo::modtime), "modtime");
-	chai.add(constructor<FileInfo()>(), "FileInfo");
-	chai.add(constructor<FileInfo(const std::string&)>(), "FileInfo");
-	chai.add(constructor<FileInfo(const std::string&, int)>(), "FileInfo");
-	chai.add(constructor<FileInfo(const std::string&, int, int)>(), "FileInfo");
-
-	// FileData Object.
-	chai.add(user_type<FileData>(), "FileData");
-	chai.add(fun(&FileData::getSize), "getSize");
-	chai.add(fun(&FileData::getFilename), "getFilename");
-	chai.add(fun(&FileData::getString), "getString");
-	chai.add(fun(&FileData::getExtension), "getExtension");
-	chai.add(constructor<FileData(const std::string&)>(), "FileData");
-
-	// Color Object.
-	chai.add(user_type<Color>(), "Color");
-	chai.add(fun(&Color::r), "r");
-	chai.add(fun(&Color::g), "g");
-	chai.add(fun(&Color::b), "b");
-	chai.add(fun(&Color::a), "a");
-	chai.add(constructor<Color()>(), "Color");
-	chai.add(constructor<Color(int, int, int)>(), "Color");
-	chai.add(constructor<Color(int, int, int, int)>(), "Color");
-
-	// Image Object.
-	chai.add(user_type<Image>(), "Image");
-	chai.add(fun(&Image::getWidth), "getWidth");
-	chai.add(fun(&Image::getHeight), "getHeight");
-
-	// SoundData Object.
-	chai.add(user_type<SoundData>(), "SoundData");
-	chai.add(fun(&SoundData::isLooping), "isLooping");
-	chai.add(fun(&SoundData::isPlaying), "isPlaying");
-	chai.add(fun(&SoundData::setLooping), "setLooping");
-	chai.add(fun(&SoundData::stop), "stop");
-	chai.add(fun(&SoundData::play), "play");
-	chai.add(fun(&SoundData::setVolume), "setVolume");
-	chai.add(fun(&SoundData::getVolume), "getVolume");
-
-	// Font.
-	chai.add(user_type<Font>(), "Font");
-	chai.add(fun(&Font::loaded), "loaded");
-	chai.add(fun<int, Font>(&Font::getHeight), "getHeight");
-	chai.add(fun<int, Font, const std::string&>(&Font::getHeight), "getHeight");
-	chai.add(fun<int, Font, const std::string&>(&Font::getWidth), "getWidth");
-
 	// Config
 	chai.add(user_type<WindowConfig>(), "WindowConfig");
 	chai.add(fun(&WindowConfig::width), "width");
@@ -262,190 +272,70 @@ script::script(const std::string& file) {
 	chai.add(fun(&WindowConfig::hwsurface), "hwsurface");
 	chai.add(fun(&WindowConfig::doublebuffering), "doublebuffering");
 	chai.add(user_type<ModuleConfig>(), "ModuleConfig");
+	chai.add(fun(&ModuleConfig::audio), "audio");
+	chai.add(fun(&ModuleConfig::data), "data");
+	chai.add(fun(&ModuleConfig::ecs), "ecs");
+	chai.add(fun(&ModuleConfig::event), "event");
+	chai.add(fun(&ModuleConfig::font), "font");
+	chai.add(fun(&ModuleConfig::graphics), "graphics");
+	chai.add(fun(&ModuleConfig::image), "image");
+	chai.add(fun(&ModuleConfig::input), "input");
+	chai.add(fun(&ModuleConfig::joystick), "joystick");
+	chai.add(fun(&ModuleConfig::keyboard), "keyboard");
+	chai.add(fun(&ModuleConfig::math), "math");
+	chai.add(fun(&ModuleConfig::mouse), "mouse");
+	chai.add(fun(&ModuleConfig::replay), "replay");
 	chai.add(fun(&ModuleConfig::sound), "sound");
+	chai.add(fun(&ModuleConfig::system), "system");
+	chai.add(fun(&ModuleConfig::timer), "timer");
+	chai.add(fun(&ModuleConfig::window), "window");
 	chai.add(user_type<config>(), "Config");
 	chai.add(fun(&config::identity), "identity");
 	chai.add(fun(&config::version), "version");
 	chai.add(fun(&config::window), "window");
 	chai.add(fun(&config::modules), "modules");
 	chai.add(fun(&config::options), "options");
+	chai.add(fun(&config::savestateSize), "savestateSize");
 	chai.add(fun(&config::console), "console");
 
-	// Joystick
-	chai.add(user_type<Joystick>(), "Joystick");
-	chai.add(fun<bool, Joystick, const std::string&>(&Joystick::isDown), "isDown");
-	chai.add(fun<bool, Joystick, int>(&Joystick::isDown), "isDown");
-	//chai.add(fun(&Joystick::getName), "getName");
-	chai.add(fun(&Joystick::isConnected), "isConnected");
-	chai.add(fun(&Joystick::getID), "getID");
-
-	// Graphics
-	chai.add(fun(&graphics::rectangle), "rectangle");
-	chai.add(fun(&graphics::newImage), "newImage");
-	chai.add(fun<love::graphics&, graphics, const std::string&, int, int>(&graphics::print), "print");
-	chai.add(fun<love::graphics&, graphics, const std::string&>(&graphics::print), "print");
-	chai.add(fun<love::graphics&, graphics, int, int>(&graphics::point), "point");
-	chai.add(fun<love::graphics&, graphics, Point*>(&graphics::point), "point");
-	// chai.add(bootstrap::standard_library::vector_type<std::vector<Point*>>("VectorPointPointer"));
-	// chai.add(bootstrap::standard_library::vector_type<std::vector<Point>>("VectorPoint"));
-	// chai.add(fun<void, graphics, std::vector<Point*>>(&graphics::points), "points");
-	// chai.add(fun<void, graphics, std::vector<Point>>(&graphics::points), "points");
-	chai.add(fun(&graphics::arc), "arc");
-	chai.add(fun(&graphics::ellipse), "ellipse");
-	chai.add(fun(&graphics::getWidth), "getWidth");
-	chai.add(fun(&graphics::getHeight), "getHeight");
-	chai.add(fun(&graphics::getDimensions), "getDimensions");
-	chai.add(fun(&graphics::circle), "circle");
-	chai.add(fun(&graphics::line), "line");
-	chai.add(fun(&graphics::newQuad), "newQuad");
-	chai.add(fun(&graphics::setDefaultFilter), "setDefaultFilter");
-	chai.add(fun(&graphics::getDefaultFilter), "getDefaultFilter");
-	chai.add(fun<Font*, graphics, const std::string&, int>(&graphics::newFont), "newFont");
-	chai.add(fun<Font*, graphics, const std::string&>(&graphics::newFont), "newFont");
-	chai.add(fun<Font*, graphics, const std::string&, int, int, const std::string&>(&graphics::newFont), "newFont");
-	chai.add(fun<Font*, graphics, int>(&graphics::newFont), "newFont");
-	chai.add(fun<Font*, graphics>(&graphics::newFont), "newFont");
-	chai.add(fun<love::graphics&, graphics, Font*>(&graphics::setFont), "setFont");
-	chai.add(fun<love::graphics&, graphics>(&graphics::setFont), "setFont");
-	chai.add(fun<Font*, graphics>(&graphics::getFont), "getFont");
-	chai.add(fun<love::graphics&, graphics, int, int, int, int>(&graphics::setColor), "setColor");
-	chai.add(fun<love::graphics&, graphics, int, int, int>(&graphics::setColor), "setColor");
-	chai.add(fun<love::graphics&, graphics, int, int, int, int>(&graphics::setBackgroundColor), "setBackgroundColor");
-	chai.add(fun<love::graphics&, graphics, int, int, int>(&graphics::setBackgroundColor), "setBackgroundColor");
-
-	chai.add(fun<love::graphics&, graphics, Image*, int, int>(&graphics::draw), "draw");
-	chai.add(fun<love::graphics&, graphics, Image*>(&graphics::draw), "draw");
-	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float, float, float, float>(&graphics::draw), "draw");
-	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float, float, float>(&graphics::draw), "draw");
-	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float, float>(&graphics::draw), "draw");
-	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float>(&graphics::draw), "draw");
-	chai.add(fun<love::graphics&, graphics, Image*, int, int, float>(&graphics::draw), "draw");
-
-	chai.add(fun<love::graphics&, graphics, Image*, Quad, int, int>(&graphics::draw), "draw");
-	chai.add(fun<love::graphics&, graphics, Image*, Quad>(&graphics::draw), "draw");
-
-	chai.add(fun<love::graphics&, graphics, int, int, int, int>(&graphics::clear), "clear");
-	chai.add(fun<love::graphics&, graphics, int, int, int>(&graphics::clear), "clear");
-	chai.add(fun<love::graphics&, graphics>(&graphics::clear), "clear");
-
-	// Font
-	chai.add(fun(&font::isOpen), "isOpen");
-
-	// Keyboard
-	chai.add(fun<bool, keyboard, const std::string&>(&keyboard::isDown), "isDown");
-	chai.add(fun<bool, keyboard, int>(&keyboard::isDown), "isDown");
-	chai.add(fun(&keyboard::isScancodeDown), "isScancodeDown");
-	chai.add(fun(&keyboard::getKeyFromScancode), "getKeyFromScancode");
-	chai.add(fun(&keyboard::getScancodeFromKey), "getScancodeFromKey");
-
-	// Event
-	chai.add(fun(&event::quit), "quit");
-
-	// Image
-	chai.add(fun(&image::newImageData), "newImageData");
-
-	// Filesystem
-	chai.add(fun(&filesystem::unmount), "unmount");
-	chai.add(fun(&filesystem::read), "read");
-	chai.add(fun(&filesystem::isDirectory), "isDirectory");
-	chai.add(fun(&filesystem::createDirectory), "createDirectory");
-	chai.add(fun(&filesystem::isSymlink), "isSymlink");
-	chai.add(fun(&filesystem::isFile), "isFile");
-	chai.add(fun(&filesystem::write), "write");
-	chai.add(fun(&filesystem::exists), "exists");
-	chai.add(fun(&filesystem::getExecutablePath), "getExecutablePath");
-	chai.add(fun(&filesystem::getSaveDirectory), "getSaveDirectory");
-	chai.add(fun(&filesystem::getInfo), "getInfo");
-	chai.add(fun<FileData, filesystem, const std::string&>(&filesystem::newFileData), "newFileData");
-	chai.add(fun<FileData, filesystem, const std::string&, const std::string&>(&filesystem::newFileData), "newFileData");
-	chai.add(fun(&filesystem::getDirectoryItems), "getDirectoryItems");
-	chai.add(fun<bool, filesystem, const std::string&, const std::string&, bool>(&filesystem::mount), "mount");
-	chai.add(fun<bool, filesystem, const std::string&, const std::string&>(&filesystem::mount), "mount");
-	chai.add(fun<int, filesystem, const std::string&>(&filesystem::getSize), "getSize");
-	chai.add(fun<std::vector<std::string>, filesystem, const std::string&>(&filesystem::lines), "lines");
-	chai.add(fun<std::vector<std::string>, filesystem, const std::string&, const std::string&>(&filesystem::lines), "lines");
-	chai.add(fun(&filesystem::load), "load");
-	chai.add(fun(&script::require, this), "require");
-	chai.add(fun(&filesystem::getFileExtension), "getFileExtension");
-	chai.add(fun(&filesystem::getBasename), "getBasename");
-	chai.add(fun(&filesystem::getParentDirectory), "getParentDirectory");
-
-	// System
-	chai.add(fun(&system::getOS), "getOS");
-	chai.add(fun(&system::getVersion), "getVersion");
-	chai.add(fun(&system::getVersionString), "getVersionString");
-	chai.add(fun(&system::getUsername), "getUsername");
-	chai.add(fun(&system::getClipboardText), "getClipboardText");
-	chai.add(fun(&system::setClipboardText), "setClipboardText");
-	chai.add(fun(&system::execute), "execute");
-
-	// Mouse
-	chai.add(fun(&mouse::getX), "getX");
-	chai.add(fun(&mouse::getY), "getY");
-	chai.add(fun(&mouse::getPosition), "getPosition");
-	chai.add(fun<bool, mouse, const std::string&>(&mouse::isDown), "isDown");
-	chai.add(fun<bool, mouse, int>(&mouse::isDown), "isDown");
-
-	// Sound
-	chai.add(fun<SoundData*, sound, const std::string&>(&sound::newSoundData), "newSoundData");
-
-	// Audio
-	chai.add(fun(&audio::play), "play");
-	chai.add(fun<SoundData*, audio, const std::string&, const std::string&>(&audio::newSource), "newSource");
-	chai.add(fun<SoundData*, audio, const std::string&>(&audio::newSource), "newSource");
-	chai.add(fun(&audio::getVolume), "getVolume");
-	chai.add(fun(&audio::setVolume), "setVolume");
-
-	// Window
-	chai.add(fun(&window::setTitle), "setTitle");
-	chai.add(fun(&window::getTitle), "getTitle");
-	chai.add(fun<love::window&, window, const std::string&, int>(&window::showMessageBox), "showMessageBox");
-	chai.add(fun<love::window&, window, const std::string&>(&window::showMessageBox), "showMessageBox");
-
-	// Timer
-	chai.add(fun(&timer::getDelta), "getDelta");
-	chai.add(fun(&timer::getFPS), "getFPS");
-	chai.add(fun(&timer::step), "step");
-
-	// Joystick
-	chai.add(fun(&joystick::getJoysticks), "getJoysticks");
-	chai.add(fun(&joystick::getJoystickCount), "getJoystickCount");
-	chai.add(fun<bool, joystick, int, const std::string&>(&joystick::isDown), "isDown");
-	chai.add(fun<bool, joystick, int, int>(&joystick::isDown), "isDown");
-	chai.add(fun(&joystick::operator[]), "[]");
-
-	// Math
-	auto mathlib = chaiscript::extras::math::bootstrap();
-	chai.add(mathlib);
-	chai.add(fun(&math::pi), "pi");
-	chai.add(fun(&math::e), "e");
-	chai.add(fun(&math::rad), "rad");
-	chai.add(fun(&math::degrees), "degrees");
-	chai.add(fun<float, math>(&math::random), "random");
-	chai.add(fun<float, math, float>(&math::random), "random");
-	chai.add(fun<float, math, float, float>(&math::random), "random");
-	chai.add(fun<int, math, int>(&math::random), "random");
-	chai.add(fun<int, math, int, int>(&math::random), "random");
-	chai.add(fun<double, math, double>(&math::random), "random");
-	chai.add(fun<double, math, double, double>(&math::random), "random");
-	chai.add(fun<love::math&, math, int>(&math::setRandomSeed), "setRandomSeed");
-	chai.add(fun<love::math&, math, int, int>(&math::setRandomSeed), "setRandomSeed");
-	chai.add(fun(&math::getRandomSeed), "getRandomSeed");
-
-	// Data
-	chai.add(fun<std::string, data, const std::string&>(&data::compress), "compress");
-	chai.add(fun<std::string, data, const std::string&, int>(&data::compress), "compress");
-	chai.add(fun(&data::decompress), "decompress");
-	chai.add(fun(&data::hash), "hash");
-	chai.add(fun(&data::encode), "encode");
-	chai.add(fun(&data::decode), "decode");
+	addTiming("core", &start, &timings);
 
 	// Ensure the love namespace is imported and ready.
 	chai.import("love");
+	chaiscript::Namespace& love = chai.eval<chaiscript::Namespace&>("love");
+
+	// Register the modules that can't be disabled.
+	for (const ModuleBinding& binding : moduleBindings) {
+		if (binding.enabled == NULL) {
+			(this->*binding.bind)();
+			love[binding.name] = binding.object();
+			addTiming(binding.name, &start, &timings);
+		}
+	}
 
-	// Load the main.chai file.
+	// Load conf.chai, and run its conf(t) before registering the rest of the modules, so that it can disable them.
 	require("conf");
+	try {
+		chaiconf = chai.eval<std::function<void(config&)> >("conf");
+		conf(app->config);
+	}
+	catch (const std::exception&) {
+		// conf(t) may also be defined along with the main module.
+	}
+	addTiming("conf", &start, &timings);
+
+	// Register the bindings of all the enabled modules.
+	ModuleConfig& modules = app->config.modules;
+	for (const ModuleBinding& binding : moduleBindings) {
+		if (binding.enabled != NULL && modules.*binding.enabled) {
+			(this->*binding.bind)();
+			love[binding.name] = binding.object();
+			addTiming(binding.name, &start, &timings);
+		}
+	}
+	m_modulesRegistered = true;
 
+	// Load the main.chai file.
 	std::string extension(app->filesystem.getFileExtension(file));
 	if (extension == "chailove" || extension == "chaigame") {
 		mainLoaded = require("main");
@@ -455,6 +345,9 @@ script::script(const std::string& file) {
 		mainLoaded = require(filename);
 	}
 
+	addTiming("main", &start, &timings);
+	pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [script] Startup:%s", timings.c_str());
+
 	// Find the game functions.
 	try {
 		chaiload = chai.eval<std::function<void()> >("load");
@@ -564,6 +457,13 @@ script::script(const std::string& file) {
 		pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [script] keyreleased() %s", e.what());
 		haskeyreleased = false;
 	}
+	try {
+		chaievents = chai.eval<std::function<void(const std::vector<Event>&)> >("events");
+	}
+	catch (const std::exception& e) {
+		pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [script] events() %s", e.what());
+		hasevents = false;
+	}
 	try {
 		chailoadstate = chai.eval<std::function<bool(const std::string&)> >("loadstate");
 	}
@@ -578,6 +478,20 @@ script::script(const std::string& file) {
 		pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [script] savestate() %s", e.what());
 		hassavestate = false;
 	}
+	try {
+		chaiserialize = chai.eval<std::function<void(ByteData&)> >("serialize");
+	}
+	catch (const std::exception& e) {
+		pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [script] serialize() %s", e.what());
+		hasserialize = false;
+	}
+	try {
+		chaiunserialize = chai.eval<std::function<bool(ByteData&)> >("unserialize");
+	}
+	catch (const std::exception& e) {
+		pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [script] unserialize() %s", e.what());
+		hasunserialize = false;
+	}
 	try {
 		chaicheatreset = chai.eval<std::function<void()> >("cheatreset");
 	}
@@ -602,11 +516,663 @@ script::script(const std::string& file) {
 	#endif
 }
 
-void script::conf(config& t) {
+#ifdef __HAVE_CHAISCRIPT__
+void script::addTiming(const char* name, std::chrono::steady_clock::time_point* start, std::string* timings) {
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	char timing[64];
+	snprintf(timing, sizeof(timing), " %s %.2fms", name, std::chrono::duration<double, std::milli>(now - *start).count());
+	*timings += timing;
+	*start = now;
+}
+
+void script::registerByteDataType() {
+	if (!m_registeredTypes.insert("ByteData").second) {
+		return;
+	}
+	chai.add(user_type<ByteData>(), "ByteData");
+	chai.add(constructor<ByteData()>(), "ByteData");
+	chai.add(constructor<ByteData(int)>(), "ByteData");
+	chai.add(constructor<ByteData(const std::string&)>(), "ByteData");
+	chai.add(constructor<ByteData(const ByteData&)>(), "ByteData");
+	chai.add(fun(&ByteData::clear), "clear");
+	chai.add(fun(&ByteData::resize), "resize");
+	chai.add(fun(&ByteData::getSize), "getSize");
+	chai.add(fun(&ByteData::getString), "getString");
+	chai.add(fun<ByteData, ByteData, int, int>(&ByteData::getView), "getView");
+	chai.add(fun<ByteData, ByteData, int>(&ByteData::getView), "getView");
+	chai.add(fun(&ByteData::clone), "clone");
+	chai.add(fun(&ByteData::tell), "tell");
+	chai.add(fun(&ByteData::seek), "seek");
+	chai.add(fun(&ByteData::isEOF), "isEOF");
+	chai.add(fun(&ByteData::writeByte), "writeByte");
+	chai.add(fun(&ByteData::writeBool), "writeBool");
+	chai.add(fun(&ByteData::writeInt), "writeInt");
+	chai.add(fun(&ByteData::writeFloat), "writeFloat");
+	chai.add(fun(&ByteData::writeDouble), "writeDouble");
+	chai.add(fun(&ByteData::writeString), "writeString");
+	chai.add(fun(&ByteData::readByte), "readByte");
+	chai.add(fun(&ByteData::readBool), "readBool");
+	chai.add(fun(&ByteData::readInt), "readInt");
+	chai.add(fun(&ByteData::readFloat), "readFloat");
+	chai.add(fun(&ByteData::readDouble), "readDouble");
+	chai.add(fun(&ByteData::readString), "readString");
+	chai.add(fun(&ByteData::getInt8), "getInt8");
+	chai.add(fun(&ByteData::getUint8), "getUint8");
+	chai.add(fun(&ByteData::getInt16), "getInt16");
+	chai.add(fun(&ByteData::getUint16), "getUint16");
+	chai.add(fun(&ByteData::getInt32), "getInt32");
+	chai.add(fun(&ByteData::getUint32), "getUint32");
+	chai.add(fun(&ByteData::getFloat32), "getFloat32");
+	chai.add(fun(&ByteData::getFloat64), "getFloat64");
+	chai.add(fun(&ByteData::setInt8), "setInt8");
+	chai.add(fun(&ByteData::setUint8), "setUint8");
+	chai.add(fun(&ByteData::setInt16), "setInt16");
+	chai.add(fun(&ByteData::setUint16), "setUint16");
+	chai.add(fun(&ByteData::setInt32), "setInt32");
+	chai.add(fun(&ByteData::setUint32), "setUint32");
+	chai.add(fun(&ByteData::setFloat32), "setFloat32");
+	chai.add(fun(&ByteData::setFloat64), "setFloat64");
+}
+
+void script::registerButtonStateType() {
+	if (!m_registeredTypes.insert("ButtonState").second) {
+		return;
+	}
+	chai.add(user_type<ButtonState>(), "ButtonState");
+	chai.add(fun(&ButtonState::getCount), "getCount");
+	chai.add(fun(&ButtonState::isDown), "isDown");
+	chai.add(fun(&ButtonState::wasPressed), "wasPressed");
+	chai.add(fun(&ButtonState::wasReleased), "wasReleased");
+	chai.add(fun(&ButtonState::getCurrent), "getCurrent");
+	chai.add(fun(&ButtonState::getPrevious), "getPrevious");
+}
+
+void script::registerFontType() {
+	if (!m_registeredTypes.insert("Font").second) {
+		return;
+	}
+	chai.add(user_type<Font>(), "Font");
+	chai.add(fun(&Font::loaded), "loaded");
+	chai.add(fun<int, Font>(&Font::getHeight), "getHeight");
+	chai.add(fun<int, Font, const std::string&>(&Font::getHeight), "getHeight");
+	chai.add(fun<int, Font, const std::string&>(&Font::getWidth), "getWidth");
+}
+
+void script::registerImageType() {
+	if (!m_registeredTypes.insert("Image").second) {
+		return;
+	}
+	chai.add(user_type<Image>(), "Image");
+	chai.add(fun(&Image::getWidth), "getWidth");
+	chai.add(fun(&Image::getHeight), "getHeight");
+}
+
+void script::registerPointType() {
+	if (!m_registeredTypes.insert("Point").second) {
+		return;
+	}
+	chai.add(user_type<Point>(), "Point");
+	chai.add(fun(&Point::x), "x");
+	chai.add(fun(&Point::y), "y");
+	chai.add(constructor<Point()>(), "Point");
+	chai.add(constructor<Point(float)>(), "Point");
+	chai.add(constructor<Point(float, float)>(), "Point");
+}
+
+void script::registerSoundDataType() {
+	if (!m_registeredTypes.insert("SoundData").second) {
+		return;
+	}
+	chai.add(user_type<SoundData>(), "SoundData");
+	chai.add(fun(&SoundData::isLooping), "isLooping");
+	chai.add(fun(&SoundData::isPlaying), "isPlaying");
+	chai.add(fun(&SoundData::setLooping), "setLooping");
+	chai.add(fun(&SoundData::stop), "stop");
+	chai.add(fun(&SoundData::play), "play");
+	chai.add(fun(&SoundData::setVolume), "setVolume");
+	chai.add(fun(&SoundData::getVolume), "getVolume");
+}
+
+void script::registerVector2Type() {
+	if (!m_registeredTypes.insert("Vector2").second) {
+		return;
+	}
+	chai.add(user_type<Vector2>(), "Vector2");
+	chai.add(constructor<Vector2()>(), "Vector2");
+	chai.add(constructor<Vector2(float)>(), "Vector2");
+	chai.add(constructor<Vector2(float, float)>(), "Vector2");
+	chai.add(constructor<Vector2(const Vector2&)>(), "Vector2");
+	chai.add(fun([](const Vector2& vector) { return vector; }), "clone");
+	chai.add(fun(&Vector2::x), "x");
+	chai.add(fun(&Vector2::y), "y");
+	chai.add(fun<Vector2&, Vector2, const Vector2&>(&Vector2::operator=), "=");
+	chai.add(fun<Vector2, Vector2, const Vector2&>(&Vector2::operator+), "+");
+	chai.add(fun<Vector2, Vector2, const Vector2&>(&Vector2::operator-), "-");
+	chai.add(fun<Vector2, Vector2>(&Vector2::operator-), "-");
+	chai.add(fun<Vector2, Vector2, const Vector2&>(&Vector2::operator*), "*");
+	chai.add(fun<Vector2, Vector2, float>(&Vector2::operator*), "*");
+	chai.add(fun<Vector2, float, const Vector2&>(&love::Types::Math::operator*), "*");
+	chai.add(fun<Vector2, Vector2, const Vector2&>(&Vector2::operator/), "/");
+	chai.add(fun<Vector2, Vector2, float>(&Vector2::operator/), "/");
+	chai.add(fun(&Vector2::operator+=), "+=");
+	chai.add(fun(&Vector2::operator-=), "-=");
+	chai.add(fun(&Vector2::operator*=), "*=");
+	chai.add(fun(&Vector2::operator/=), "/=");
+	chai.add(fun(&Vector2::operator==), "==");
+	chai.add(fun(&Vector2::operator!=), "!=");
+	chai.add(fun(&Vector2::set), "set");
+	chai.add(fun(&Vector2::dot), "dot");
+	chai.add(fun(&Vector2::cross), "cross");
+	chai.add(fun(&Vector2::length), "length");
+	chai.add(fun(&Vector2::lengthSquared), "lengthSquared");
+	chai.add(fun(&Vector2::distance), "distance");
+	chai.add(fun(&Vector2::angle), "angle");
+	chai.add(fun(&Vector2::normalized), "normalized");
+	chai.add(fun(&Vector2::normalizeInplace), "normalizeInplace");
+	chai.add(fun(&Vector2::rotated), "rotated");
+	chai.add(fun(&Vector2::rotateInplace), "rotateInplace");
+	chai.add(fun(&Vector2::lerp), "lerp");
+	chai.add(fun(&Vector2::lerpInplace), "lerpInplace");
+	chai.add(fun(&Vector2::toString), "to_string");
+}
+
+void script::registerAudio() {
+	registerSoundDataType();
+
+	chai.add(fun(&audio::play), "play");
+	chai.add(fun<SoundData*, audio, const std::string&, const std::string&>(&audio::newSource), "newSource");
+	chai.add(fun<SoundData*, audio, const std::string&>(&audio::newSource), "newSource");
+	chai.add(fun<SoundData*, audio, FileData&>(&audio::newSource), "newSource");
+	chai.add(fun(&audio::getVolume), "getVolume");
+	chai.add(fun(&audio::setVolume), "setVolume");
+}
+
+void script::registerData() {
+	// Struct Object.
+	chai.add(user_type<StructType>(), "StructType");
+	chai.add(fun(&StructType::getName), "getName");
+	chai.add(fun(&StructType::getFields), "getFields");
+	chai.add(user_type<Struct>(), "Struct");
+	chai.add(fun(&Struct::getTypeName), "getTypeName");
+	chai.add(fun([](const Struct& record) { return record; }), "clone");
+	chai.add(fun<Struct&, Struct, const Struct&>(&Struct::operator=), "=");
+
+	// Compressor Object.
+	chai.add(user_type<Compressor>(), "Compressor");
+	chai.add(fun(&Compressor::isFinished), "isFinished");
+	chai.add(fun(&Compressor::push), "push");
+	chai.add(fun(&Compressor::finish), "finish");
+	chai.add(fun(&Compressor::getTotalIn), "getTotalIn");
+	chai.add(fun(&Compressor::getTotalOut), "getTotalOut");
+
+	registerByteDataType();
+
+	chai.add(fun<std::string, data, const std::string&>(&data::compress), "compress");
+	chai.add(fun<std::string, data, const std::string&, int>(&data::compress), "compress");
+	chai.add(fun<std::string, data, const std::string&, const std::string&>(&data::compress), "compress");
+	chai.add(fun<std::string, data, const std::string&, const std::string&, int>(&data::compress), "compress");
+	chai.add(fun<std::string, data, const std::string&, ByteData&>(&data::compress), "compress");
+	chai.add(fun<std::string, data, const std::string&, ByteData&, int>(&data::compress), "compress");
+	chai.add(fun<std::string, data, const std::string&>(&data::decompress), "decompress");
+	chai.add(fun<std::string, data, const std::string&, const std::string&>(&data::decompress), "decompress");
+	chai.add(fun<std::string, data, const std::string&, ByteData&>(&data::decompress), "decompress");
+	chai.add(fun<std::string, data, const std::string&, const std::string&>(&data::hash), "hash");
+	chai.add(fun<std::string, data, const std::string&, ByteData&>(&data::hash), "hash");
+	chai.add(fun<std::string, data, const std::string&, const std::string&, const std::string&>(&data::encode), "encode");
+	chai.add(fun<std::string, data, const std::string&, const std::string&, ByteData&>(&data::encode), "encode");
+	chai.add(fun(&data::decode), "decode");
+	chai.add(fun<std::string, data, const Boxed_Value&>(&data::serialize), "serialize");
+	chai.add(fun<bool, data, const Boxed_Value&, ByteData&>(&data::serialize), "serialize");
+	chai.add(fun<Boxed_Value, data, const std::string&>(&data::deserialize), "deserialize");
+	chai.add(fun<Boxed_Value, data, ByteData&>(&data::deserialize), "deserialize");
+	chai.add(fun<ByteData, data, int>(&data::newByteData), "newByteData");
+	chai.add(fun<ByteData, data, const std::string&>(&data::newByteData), "newByteData");
+	chai.add(fun(&data::pack), "pack");
+	chai.add(fun<std::vector<Boxed_Value>, data, const std::string&, ByteData&, int>(&data::unpack), "unpack");
+	chai.add(fun<std::vector<Boxed_Value>, data, const std::string&, ByteData&>(&data::unpack), "unpack");
+	chai.add(fun<std::vector<Boxed_Value>, data, const std::string&, const std::string&>(&data::unpack), "unpack");
+	chai.add(fun(&data::getSavestateStats), "getSavestateStats");
+	chai.add(fun<std::shared_ptr<Compressor>, data, const std::string&, int>(&data::newCompressor), "newCompressor");
+	chai.add(fun<std::shared_ptr<Compressor>, data, const std::string&>(&data::newCompressor), "newCompressor");
+	chai.add(fun(&data::newDecompressor), "newDecompressor");
+	chai.add(fun([this](data& module, const std::string& name, const std::vector<std::string>& fields) {
+		StructType* type = module.newStruct(name, fields);
+		if (type != NULL) {
+			registerStruct(type);
+		}
+		return type;
+	}), "newStruct");
+}
+
+void script::registerEcs() {
+	// World Object.
+	chai.add(user_type<World>(), "World");
+	chai.add(fun(&World::addComponent), "addComponent");
+	chai.add(fun(&World::hasComponent), "hasComponent");
+	chai.add(fun<int, World>(&World::spawn), "spawn");
+	chai.add(fun<int, World, int>(&World::spawn), "spawn");
+	chai.add(fun(&World::remove), "remove");
+	chai.add(fun(&World::clear), "clear");
+	chai.add(fun(&World::getCount), "getCount");
+	chai.add(fun(&World::getField), "getField");
+	chai.add(fun<float, World, int, int>(&World::get), "get");
+	chai.add(fun<float, World, const std::string&, const std::string&, int>(&World::get), "get");
+	chai.add(fun<World&, World, int, int, float>(&World::set), "set");
+	chai.add(fun<World&, World, const std::string&, const std::string&, int, float>(&World::set), "set");
+	chai.add(fun(&World::integrate), "integrate");
+	chai.add(fun(&World::accelerate), "accelerate");
+	chai.add(fun(&World::bounce), "bounce");
+	chai.add(fun(&World::draw), "draw");
+
+	chai.add(fun(&ecs::newWorld), "newWorld");
+}
+
+void script::registerStruct(StructType* type) {
+	// Add a constructor named after the record type.
+	if (m_structs.insert(type->getName()).second) {
+		chai.add(fun([type]() { return Struct(type); }), type->getName());
+	}
+
+	// Each field name gets one accessor, shared by all record types, which finds the slot through the field ID.
+	for (const StructType::Field& field : type->getFieldList()) {
+		if (!m_structFields.insert(field.name).second) {
+			continue;
+		}
+		int fieldID = StructType::getFieldID(field.name);
+		chai.add(fun([fieldID](Struct& record) -> Boxed_Value {
+			const StructType::Field* slot = record.getType()->getField(fieldID);
+			if (slot == NULL) {
+				throw std::runtime_error(record.getTypeName() + " has no such field");
+			}
+			switch (slot->type) {
+				case StructType::FIELD_INT:
+					return Boxed_Value(std::ref(record.getInt(slot->slot)));
+				case StructType::FIELD_BOOL:
+					return Boxed_Value(std::ref(record.getBool(slot->slot)));
+				case StructType::FIELD_STRING:
+					return Boxed_Value(std::ref(record.getString(slot->slot)));
+				default:
+					return Boxed_Value(std::ref(record.getFloat(slot->slot)));
+			}
+		}), field.name);
+	}
+}
+
+void script::registerEvent() {
+	// Event Object.
+	chai.add(user_type<Event>(), "Event");
+	chai.add(constructor<Event()>(), "Event");
+	chai.add(fun([](const Event& e) { return e; }), "clone");
+	chai.add(fun(&Event::type), "type");
+	chai.add(fun(&Event::x), "x");
+	chai.add(fun(&Event::y), "y");
+	chai.add(fun(&Event::dx), "dx");
+	chai.add(fun(&Event::dy), "dy");
+	chai.add(fun(&Event::button), "button");
+	chai.add(fun(&Event::key), "key");
+	chai.add(fun(&Event::joystick), "joystick");
+	chai.add(bootstrap::standard_library::vector_type<std::vector<Event>>("EventList"));
+
+	chai.add(fun(&event::quit), "quit");
+	chai.add(fun<void, event, const Event&>(&event::push), "push");
+	chai.add(fun(&event::pump), "pump");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::KEYPRESSED); }), "KEYPRESSED");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::KEYRELEASED); }), "KEYRELEASED");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::MOUSEPRESSED); }), "MOUSEPRESSED");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::MOUSERELEASED); }), "MOUSERELEASED");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::MOUSEMOVED); }), "MOUSEMOVED");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::WHEELMOVED); }), "WHEELMOVED");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::GAMEPADPRESSED); }), "GAMEPADPRESSED");
+	chai.add(fun([](const event&) { return static_cast<int>(Event::GAMEPADRELEASED); }), "GAMEPADRELEASED");
+}
+
+void script::registerFilesystem() {
+	// FileInfo Object.
+	chai.add(user_type<FileInfo>(), "FileInfo");
+	chai.add(fun(&FileInfo::type), "type");
+	chai.add(fun(&FileInfo::size), "size");
+	chai.add(fun(&FileInfo::modtime), "modtime");
+	chai.add(constructor<FileInfo()>(), "FileInfo");
+	chai.add(constructor<FileInfo(const std::string&)>(), "FileInfo");
+	chai.add(constructor<FileInfo(const std::string&, int)>(), "FileInfo");
+	chai.add(constructor<FileInfo(const std::string&, int, int)>(), "FileInfo");
+
+	// FileData Object.
+	chai.add(user_type<FileData>(), "FileData");
+	chai.add(fun(&FileData::getSize), "getSize");
+	chai.add(fun(&FileData::getFilename), "getFilename");
+	chai.add(fun(&FileData::getString), "getString");
+	chai.add(fun(&FileData::getExtension), "getExtension");
+	chai.add(constructor<FileData(const std::string&)>(), "FileData");
+
+	// File Object.
+	chai.add(user_type<File>(), "File");
+	chai.add(fun(&File::open), "open");
+	chai.add(fun(&File::close), "close");
+	chai.add(fun(&File::isOpen), "isOpen");
+	chai.add(fun(&File::getMode), "getMode");
+	chai.add(fun(&File::getFilename), "getFilename");
+	chai.add(fun<bool, File, const std::string&>(&File::write), "write");
+	chai.add(fun<bool, File, ByteData&>(&File::write), "write");
+	chai.add(fun<std::string, File>(&File::read), "read");
+	chai.add(fun<std::string, File, int>(&File::read), "read");
+	chai.add(fun(&File::flush), "flush");
+	chai.add(fun(&File::setBuffer), "setBuffer");
+	chai.add(fun(&File::getBuffer), "getBuffer");
+	chai.add(fun(&File::tell), "tell");
+	chai.add(fun(&File::seek), "seek");
+	chai.add(fun(&File::isEOF), "isEOF");
+	chai.add(fun(&File::getSize), "getSize");
+
+	// FileRequest Object.
+	chai.add(user_type<FileRequest>(), "FileRequest");
+	chai.add(fun(&FileRequest::isDone), "isDone");
+	chai.add(fun(&FileRequest::isSuccessful), "isSuccessful");
+	chai.add(fun(&FileRequest::getFilename), "getFilename");
+	chai.add(fun(&FileRequest::getContents), "getContents");
+	chai.add(fun(&FileRequest::getItems), "getItems");
+	chai.add(fun(&FileRequest::getError), "getError");
+
+	// LineIterator Object.
+	chai.add(user_type<LineIterator>(), "LineIterator");
+	chai.add(fun(&LineIterator::hasNext), "hasNext");
+	chai.add(fun(&LineIterator::next), "next");
+	chai.add(fun(&LineIterator::close), "close");
+
+	registerByteDataType();
+
+	chai.add(fun(&filesystem::unmount), "unmount");
+	chai.add(fun(&filesystem::read), "read");
+	chai.add(fun(&filesystem::isDirectory), "isDirectory");
+	chai.add(fun(&filesystem::createDirectory), "createDirectory");
+	chai.add(fun(&filesystem::isSymlink), "isSymlink");
+	chai.add(fun(&filesystem::isFile), "isFile");
+	chai.add(fun<bool, filesystem, const std::string&, const std::string&>(&filesystem::write), "write");
+	chai.add(fun<bool, filesystem, const std::string&, ByteData&>(&filesystem::write), "write");
+	chai.add(fun<bool, filesystem, const std::string&, const std::string&>(&filesystem::append), "append");
+	chai.add(fun<bool, filesystem, const std::string&, ByteData&>(&filesystem::append), "append");
+	chai.add(fun<std::shared_ptr<File>, filesystem, const std::string&, const std::string&>(&filesystem::newFile), "newFile");
+	chai.add(fun<std::shared_ptr<File>, filesystem, const std::string&>(&filesystem::newFile), "newFile");
+	chai.add(fun(&filesystem::hash), "hash");
+	chai.add(fun<std::shared_ptr<FileRequest>, filesystem, const std::string&, const FileRequest::Callback&>(&filesystem::readAsync), "readAsync");
+	chai.add(fun<std::shared_ptr<FileRequest>, filesystem, const std::string&>(&filesystem::readAsync), "readAsync");
+	chai.add(fun<std::shared_ptr<FileRequest>, filesystem, const std::string&, const std::string&, const FileRequest::Callback&>(&filesystem::writeAsync), "writeAsync");
+	chai.add(fun<std::shared_ptr<FileRequest>, filesystem, const std::string&, const std::string&>(&filesystem::writeAsync), "writeAsync");
+	chai.add(fun<std::shared_ptr<FileRequest>, filesystem, const std::string&, const FileRequest::Callback&>(&filesystem::getDirectoryItemsAsync), "getDirectoryItemsAsync");
+	chai.add(fun<std::shared_ptr<FileRequest>, filesystem, const std::string&>(&filesystem::getDirectoryItemsAsync), "getDirectoryItemsAsync");
+	chai.add(fun(&filesystem::setCacheBudget), "setCacheBudget");
+	chai.add(fun(&filesystem::getCacheBudget), "getCacheBudget");
+	chai.add(fun(&filesystem::preload), "preload");
+	chai.add(fun<bool, filesystem, const std::string&>(&filesystem::evict), "evict");
+	chai.add(fun<bool, filesystem>(&filesystem::evict), "evict");
+	chai.add(fun(&filesystem::getCacheStats), "getCacheStats");
+	chai.add(fun(&filesystem::exists), "exists");
+	chai.add(fun(&filesystem::getExecutablePath), "getExecutablePath");
+	chai.add(fun(&filesystem::getSaveDirectory), "getSaveDirectory");
+	chai.add(fun(&filesystem::getInfo), "getInfo");
+	chai.add(fun<FileData, filesystem, const std::string&>(&filesystem::newFileData), "newFileData");
+	chai.add(fun<FileData, filesystem, const std::string&, const std::string&>(&filesystem::newFileData), "newFileData");
+	chai.add(fun(&filesystem::getDirectoryItems), "getDirectoryItems");
+	chai.add(fun<bool, filesystem, const std::string&, const std::string&, bool>(&filesystem::mount), "mount");
+	chai.add(fun<bool, filesystem, const std::string&, const std::string&>(&filesystem::mount), "mount");
+	chai.add(fun<int, filesystem, const std::string&>(&filesystem::getSize), "getSize");
+	chai.add(fun<std::vector<std::string>, filesystem, const std::string&>(&filesystem::lines), "lines");
+	chai.add(fun<std::vector<std::string>, filesystem, const std::string&, const std::string&>(&filesystem::lines), "lines");
+	chai.add(fun<std::shared_ptr<LineIterator>, filesystem, const std::string&>(&filesystem::newLineIterator), "newLineIterator");
+	chai.add(fun<std::shared_ptr<LineIterator>, filesystem, const std::string&, const std::string&>(&filesystem::newLineIterator), "newLineIterator");
+	chai.add(fun(&filesystem::load), "load");
+	chai.add(fun(&filesystem::getFileExtension), "getFileExtension");
+	chai.add(fun(&filesystem::getBasename), "getBasename");
+	chai.add(fun(&filesystem::getParentDirectory), "getParentDirectory");
+}
+
+void script::registerFont() {
+	registerFontType();
+
+	chai.add(fun(&font::isOpen), "isOpen");
+}
+
+void script::registerGraphics() {
+	// Quad Object.
+	chai.add(user_type<Quad>(), "Quad");
+	chai.add(constructor<Quad()>(), "Quad");
+	chai.add(fun(&Quad::x), "x");
+	chai.add(fun(&Quad::y), "y");
+	chai.add(fun(&Quad::width), "width");
+	chai.add(fun(&Quad::height), "height");
+	chai.add(fun(&Quad::sw), "sw");
+	chai.add(fun(&Quad::sh), "sh");
+
+	// Color Object.
+	chai.add(user_type<Color>(), "Color");
+	chai.add(fun(&Color::r), "r");
+	chai.add(fun(&Color::g), "g");
+	chai.add(fun(&Color::b), "b");
+	chai.add(fun(&Color::a), "a");
+	chai.add(constructor<Color()>(), "Color");
+	chai.add(constructor<Color(int, int, int)>(), "Color");
+	chai.add(constructor<Color(int, int, int, int)>(), "Color");
+
+	registerImageType();
+	registerFontType();
+	registerPointType();
+	registerVector2Type();
+
+	chai.add(fun(&graphics::rectangle), "rectangle");
+	chai.add(fun<Image*, graphics, const std::string&>(&graphics::newImage), "newImage");
+	chai.add(fun<Image*, graphics, FileData&>(&graphics::newImage), "newImage");
+	chai.add(fun<love::graphics&, graphics, const std::string&, int, int>(&graphics::print), "print");
+	chai.add(fun<love::graphics&, graphics, const std::string&>(&graphics::print), "print");
+	chai.add(fun<love::graphics&, graphics, int, int>(&graphics::point), "point");
+	chai.add(fun<love::graphics&, graphics, Point*>(&graphics::point), "point");
+	chai.add(fun<love::graphics&, graphics, const Vector2&>(&graphics::point), "point");
+	// chai.add(bootstrap::standard_library::vector_type<std::vector<Point*>>("VectorPointPointer"));
+	// chai.add(bootstrap::standard_library::vector_type<std::vector<Point>>("VectorPoint"));
+	// chai.add(fun<void, graphics, std::vector<Point*>>(&graphics::points), "points");
+	// chai.add(fun<void, graphics, std::vector<Point>>(&graphics::points), "points");
+	chai.add(fun(&graphics::arc), "arc");
+	chai.add(fun(&graphics::ellipse), "ellipse");
+	chai.add(fun(&graphics::getWidth), "getWidth");
+	chai.add(fun(&graphics::getHeight), "getHeight");
+	chai.add(fun(&graphics::getDimensions), "getDimensions");
+	chai.add(fun(&graphics::circle), "circle");
+	chai.add(fun(&graphics::line), "line");
+	chai.add(fun(&graphics::newQuad), "newQuad");
+	chai.add(fun(&graphics::setDefaultFilter), "setDefaultFilter");
+	chai.add(fun(&graphics::getDefaultFilter), "getDefaultFilter");
+	chai.add(fun<Font*, graphics, const std::string&, int>(&graphics::newFont), "newFont");
+	chai.add(fun<Font*, graphics, const std::string&>(&graphics::newFont), "newFont");
+	chai.add(fun<Font*, graphics, FileData&, int>(&graphics::newFont), "newFont");
+	chai.add(fun<Font*, graphics, FileData&>(&graphics::newFont), "newFont");
+	chai.add(fun<Font*, graphics, const std::string&, int, int, const std::string&>(&graphics::newFont), "newFont");
+	chai.add(fun<Font*, graphics, int>(&graphics::newFont), "newFont");
+	chai.add(fun<Font*, graphics>(&graphics::newFont), "newFont");
+	chai.add(fun<love::graphics&, graphics, Font*>(&graphics::setFont), "setFont");
+	chai.add(fun<love::graphics&, graphics>(&graphics::setFont), "setFont");
+	chai.add(fun<Font*, graphics>(&graphics::getFont), "getFont");
+	chai.add(fun<love::graphics&, graphics, int, int, int, int>(&graphics::setColor), "setColor");
+	chai.add(fun<love::graphics&, graphics, int, int, int>(&graphics::setColor), "setColor");
+	chai.add(fun<love::graphics&, graphics, int, int, int, int>(&graphics::setBackgroundColor), "setBackgroundColor");
+	chai.add(fun<love::graphics&, graphics, int, int, int>(&graphics::setBackgroundColor), "setBackgroundColor");
+
+	chai.add(fun<love::graphics&, graphics, Image*, int, int>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float, float, float, float>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float, float, float>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float, float>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, int, int, float, float>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, int, int, float>(&graphics::draw), "draw");
+
+	chai.add(fun<love::graphics&, graphics, Image*, Quad, int, int>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, Quad>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, Quad, const Vector2&>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, const Vector2&>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, const Vector2&, float>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, const Vector2&, float, const Vector2&>(&graphics::draw), "draw");
+	chai.add(fun<love::graphics&, graphics, Image*, const Vector2&, float, const Vector2&, const Vector2&>(&graphics::draw), "draw");
+
+	chai.add(fun<love::graphics&, graphics, int, int, int, int>(&graphics::clear), "clear");
+	chai.add(fun<love::graphics&, graphics, int, int, int>(&graphics::clear), "clear");
+	chai.add(fun<love::graphics&, graphics>(&graphics::clear), "clear");
+}
+
+void script::registerImage() {
+	registerImageType();
+
+	chai.add(fun<Image*, image, const std::string&>(&image::newImageData), "newImageData");
+	chai.add(fun<Image*, image, FileData&>(&image::newImageData), "newImageData");
+}
+
+void script::registerInput() {
+	chai.add(fun<int, input, const std::string&, const std::string&, const std::string&, int>(&input::bind), "bind");
+	chai.add(fun<int, input, const std::string&, const std::string&, const std::string&>(&input::bind), "bind");
+	chai.add(fun(&input::unbind), "unbind");
+	chai.add(fun(&input::getAction), "getAction");
+	chai.add(fun<bool, input, int>(&input::isDown), "isDown");
+	chai.add(fun<bool, input, const std::string&>(&input::isDown), "isDown");
+	chai.add(fun<bool, input, int>(&input::wasPressed), "wasPressed");
+	chai.add(fun<bool, input, const std::string&>(&input::wasPressed), "wasPressed");
+	chai.add(fun<bool, input, int>(&input::wasReleased), "wasReleased");
+	chai.add(fun<bool, input, const std::string&>(&input::wasReleased), "wasReleased");
+}
+
+void script::registerJoystick() {
+	// Joystick Object.
+	chai.add(user_type<Joystick>(), "Joystick");
+	chai.add(fun<bool, Joystick, const std::string&>(&Joystick::isDown), "isDown");
+	chai.add(fun<bool, Joystick, int>(&Joystick::isDown), "isDown");
+	//chai.add(fun(&Joystick::getName), "getName");
+	chai.add(fun(&Joystick::isConnected), "isConnected");
+	chai.add(fun(&Joystick::getID), "getID");
+	chai.add(fun<bool, Joystick, const std::string&>(&Joystick::wasPressed), "wasPressed");
+	chai.add(fun<bool, Joystick, int>(&Joystick::wasPressed), "wasPressed");
+	chai.add(fun<bool, Joystick, const std::string&>(&Joystick::wasReleased), "wasReleased");
+	chai.add(fun<bool, Joystick, int>(&Joystick::wasReleased), "wasReleased");
+	chai.add(fun(&Joystick::getState), "getState");
+
+	registerButtonStateType();
+
+	chai.add(fun(&joystick::getJoysticks), "getJoysticks");
+	chai.add(fun(&joystick::getJoystickCount), "getJoystickCount");
+	chai.add(fun<bool, joystick, int, const std::string&>(&joystick::isDown), "isDown");
+	chai.add(fun<bool, joystick, int, int>(&joystick::isDown), "isDown");
+	chai.add(fun<bool, joystick, int, const std::string&>(&joystick::wasPressed), "wasPressed");
+	chai.add(fun<bool, joystick, int, int>(&joystick::wasPressed), "wasPressed");
+	chai.add(fun<bool, joystick, int, const std::string&>(&joystick::wasReleased), "wasReleased");
+	chai.add(fun<bool, joystick, int, int>(&joystick::wasReleased), "wasReleased");
+	chai.add(fun(&joystick::getState), "getState");
+	chai.add(fun(&joystick::getButtonKey), "getButtonKey");
+	chai.add(fun(&joystick::getButtonName), "getButtonName");
+	chai.add(fun(&joystick::operator[]), "[]");
+}
+
+void script::registerKeyboard() {
+	registerButtonStateType();
+
+	chai.add(fun<bool, keyboard, const std::string&>(&keyboard::isDown), "isDown");
+	chai.add(fun<bool, keyboard, int>(&keyboard::isDown), "isDown");
+	chai.add(fun(&keyboard::isScancodeDown), "isScancodeDown");
+	chai.add(fun<bool, keyboard, const std::string&>(&keyboard::wasPressed), "wasPressed");
+	chai.add(fun<bool, keyboard, int>(&keyboard::wasPressed), "wasPressed");
+	chai.add(fun<bool, keyboard, const std::string&>(&keyboard::wasReleased), "wasReleased");
+	chai.add(fun<bool, keyboard, int>(&keyboard::wasReleased), "wasReleased");
+	chai.add(fun(&keyboard::getState), "getState");
+	chai.add(fun(&keyboard::getKeyFromScancode), "getKeyFromScancode");
+	chai.add(fun(&keyboard::getScancodeFromKey), "getScancodeFromKey");
+}
+
+void script::registerMath() {
+	registerVector2Type();
+
+	auto mathlib = chaiscript::extras::math::bootstrap();
+	chai.add(mathlib);
+	chai.add(fun(&math::pi), "pi");
+	chai.add(fun(&math::e), "e");
+	chai.add(fun(&math::rad), "rad");
+	chai.add(fun(&math::degrees), "degrees");
+	chai.add(fun<float, math>(&math::random), "random");
+	chai.add(fun<float, math, float>(&math::random), "random");
+	chai.add(fun<float, math, float, float>(&math::random), "random");
+	chai.add(fun<int, math, int>(&math::random), "random");
+	chai.add(fun<int, math, int, int>(&math::random), "random");
+	chai.add(fun<double, math, double>(&math::random), "random");
+	chai.add(fun<double, math, double, double>(&math::random), "random");
+	chai.add(fun<love::math&, math, int>(&math::setRandomSeed), "setRandomSeed");
+	chai.add(fun<love::math&, math, int, int>(&math::setRandomSeed), "setRandomSeed");
+	chai.add(fun(&math::getRandomSeed), "getRandomSeed");
+}
+
+void script::registerMouse() {
+	registerPointType();
+
+	chai.add(fun(&mouse::getX), "getX");
+	chai.add(fun(&mouse::getY), "getY");
+	chai.add(fun(&mouse::getPosition), "getPosition");
+	chai.add(fun<bool, mouse, const std::string&>(&mouse::isDown), "isDown");
+	chai.add(fun<bool, mouse, int>(&mouse::isDown), "isDown");
+}
+
+void script::registerReplay() {
+	chai.add(fun(&replay::record), "record");
+	chai.add(fun(&replay::play), "play");
+	chai.add(fun(&replay::stop), "stop");
+	chai.add(fun(&replay::isRecording), "isRecording");
+	chai.add(fun(&replay::isPlaying), "isPlaying");
+	chai.add(fun(&replay::getFrame), "getFrame");
+	chai.add(fun(&replay::getMismatches), "getMismatches");
+}
+
+void script::registerSound() {
+	registerSoundDataType();
+
+	chai.add(fun<SoundData*, sound, const std::string&>(&sound::newSoundData), "newSoundData");
+}
+
+void script::registerSystem() {
+	chai.add(fun(&system::getOS), "getOS");
+	chai.add(fun(&system::getVersion), "getVersion");
+	chai.add(fun(&system::getVersionString), "getVersionString");
+	chai.add(fun(&system::getUsername), "getUsername");
+	chai.add(fun(&system::getClipboardText), "getClipboardText");
+	chai.add(fun(&system::setClipboardText), "setClipboardText");
+	chai.add(fun(&system::execute), "execute");
+}
+
+void script::registerTimer() {
+	chai.add(fun(&timer::getDelta), "getDelta");
+	chai.add(fun(&timer::getFPS), "getFPS");
+	chai.add(fun(&timer::step), "step");
+}
+
+void script::registerWindow() {
+	chai.add(fun(&window::setTitle), "setTitle");
+	chai.add(fun(&window::getTitle), "getTitle");
+	chai.add(fun<love::window&, window, const std::string&, int>(&window::showMessageBox), "showMessageBox");
+	chai.add(fun<love::window&, window, const std::string&>(&window::showMessageBox), "showMessageBox");
+}
+
+#endif
+
+void script::conf(config& t) {
 	#ifdef __HAVE_CHAISCRIPT__
+	// conf(t) is only run once, even when it was already run from conf.chai.
+	if (m_configured) {
+		return;
+	}
+	m_configured = true;
 	if (hasconf) {
 		try {
+			ModuleConfig modules = t.modules;
 			chaiconf(t);
+
+			// When conf(t) is defined with the main module, the modules are already registered.
+			if (m_modulesRegistered) {
+				for (const ModuleBinding& binding : moduleBindings) {
+					if (binding.enabled != NULL && modules.*binding.enabled != t.modules.*binding.enabled) {
+						pntr_app_log_ex(PNTR_APP_LOG_WARNING, "[ChaiLove] [script] t.modules.%s has no effect unless conf(t) is defined in conf.chai", binding.name);
+					}
+				}
+			}
 		}
 		catch (const std::exception& e) {
 			pntr_app_log_ex(PNTR_APP_LOG_INFO, "[ChaiLove] [script] Failed to invoke conf(t): %s", e.what());
@@ -814,6 +1380,40 @@ void script::keyreleased(const std::string& key, int scancode) {
 	#endif
 }
 
+void script::events(const std::vector<Event>& events) {
+	#ifdef __HAVE_CHAISCRIPT__
+	if (hasevents) {
+		try {
+			chaievents(events);
+		}
+		catch (const std::exception& e) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [script] Failed to call events(): %s", e.what());
+			hasevents = false;
+		}
+	}
+	#endif
+}
+
+bool script::hasEventsCallback() {
+	#ifdef __HAVE_CHAISCRIPT__
+	return hasevents;
+	#else
+	return false;
+	#endif
+}
+
+std::map<std::string, int> script::getModuleCacheStats() {
+	std::map<std::string, int> stats;
+	#ifdef __HAVE_CHAISCRIPT__
+	stats["modules"] = static_cast<int>(m_parsedmodules.size());
+	stats["moduleHits"] = m_parsedmoduleHits;
+	#else
+	stats["modules"] = 0;
+	stats["moduleHits"] = 0;
+	#endif
+	return stats;
+}
+
 /**
  * Call the script's savestate() function and retrieve a string.
  */
@@ -854,6 +1454,50 @@ bool script::loadstate(const std::string& data) {
 	return false;
 }
 
+/**
+ * Ask the script to write its state into the given ByteData.
+ */
+void script::serialize(ByteData& data) {
+	#ifdef __HAVE_CHAISCRIPT__
+	if (hasserialize) {
+		try {
+			chaiserialize(data);
+		}
+		catch (const std::exception& e) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [script] Failed to call serialize(): %s", e.what());
+			hasserialize = false;
+		}
+	}
+	#endif
+}
+
+/**
+ * Ask the script to read its state from the given ByteData.
+ */
+bool script::unserialize(ByteData& data) {
+	#ifdef __HAVE_CHAISCRIPT__
+	if (hasunserialize) {
+		try {
+			return chaiunserialize(data);
+		}
+		catch (const std::exception& e) {
+			pntr_app_log_ex(PNTR_APP_LOG_ERROR, "[ChaiLove] [script] Failed to call unserialize(): %s", e.what());
+			hasunserialize = false;
+		}
+	}
+	#endif
+
+	return false;
+}
+
+bool script::hasSerializeCallback() {
+	#ifdef __HAVE_CHAISCRIPT__
+	return hasserialize && hasunserialize;
+	#else
+	return false;
+	#endif
+}
+
 void script::cheatreset() {
 	#ifdef __HAVE_CHAISCRIPT__
 	if (hascheatreset) {
@@ -3,8 +3,15 @@
 
 #include <string>
 #include <list>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
 #include "config.h"
 #include "Types/Input/Joystick.h"
+#include "Types/Data/Struct.h"
+#include "Types/Data/ByteData.h"
+#include "Types/Input/Event.h"
 
 #ifdef __HAVE_CHAISCRIPT__
 #include <chaiscript/chaiscript.hpp>
@@ -14,6 +21,9 @@
 #endif
 
 using love::Types::Input::Joystick;
+using love::Types::Data::StructType;
+using love::Types::Data::ByteData;
+using love::Types::Input::Event;
 
 namespace love {
 
@@ -158,6 +168,12 @@ class script {
 	void reset();
 
 	bool mainLoaded = false;
+	bool m_configured = false;
+
+	/**
+	 * Whether the enabled modules have been registered, after which the ModuleConfig can't change them.
+	 */
+	bool m_modulesRegistered = false;
 
 	bool loadModule(const std::string& moduleName);
 
@@ -353,6 +369,43 @@ class script {
 	 */
 	void keyreleased(const std::string& key, int scancode);
 
+	/**
+	 * Called once per frame with all the input events since the last frame, when defined.
+	 *
+	 * Defining events(list) replaces the individual input callbacks, like keypressed() and mousemoved(). Consecutive mouse movements are merged into a single love.event.MOUSEMOVED event, with their deltas summed.
+	 *
+	 * @param events The list of Event objects.
+	 *
+	 * ### Example
+	 *
+	 * @code
+	 * def events(list) {
+	 *   for (e : list) {
+	 *     if (e.type == love.event.MOUSEMOVED) {
+	 *       player.aim(e.x, e.y)
+	 *     } else if (e.type == love.event.KEYPRESSED) {
+	 *       print(love.keyboard.getKeyFromScancode(e.key))
+	 *     }
+	 *   }
+	 * }
+	 * @endcode
+	 *
+	 * @see love::Types::Input::Event
+	 */
+	void events(const std::vector<Event>& events);
+
+	/**
+	 * Whether or not the script handles input events in batches with events(list).
+	 */
+	bool hasEventsCallback();
+
+	/**
+	 * Gets the number of parsed "modules" held, and the "moduleHits" where loading a module reused its parsed tree.
+	 *
+	 * @see love.filesystem.getCacheStats
+	 */
+	std::map<std::string, int> getModuleCacheStats();
+
 	/**
 	 * Called when requested to save the current state.
 	 *
@@ -397,6 +450,53 @@ class script {
 	 */
 	bool loadstate(const std::string& data);
 
+	/**
+	 * Called when requested to save the current state, by writing it into a binary ByteData.
+	 *
+	 * When defined, serialize() and unserialize() are used in place of savestate() and loadstate(). They avoid building a string every time the frontend saves the state, which happens every frame with run-ahead and rewind.
+	 *
+	 * @param data The ByteData to write the state into.
+	 *
+	 * ### Example
+	 *
+	 * @code
+	 * global score = 0
+	 *
+	 * def serialize(data) {
+	 *     data.writeInt(score)
+	 * }
+	 * @endcode
+	 *
+	 * @see unserialize
+	 * @see love::Types::Data::ByteData
+	 */
+	void serialize(ByteData& data);
+
+	/**
+	 * Called when requested to load a state that was written with serialize().
+	 *
+	 * @param data The ByteData to read the state from.
+	 *
+	 * @return bool True if loading the state succeeded.
+	 *
+	 * ### Example
+	 *
+	 * @code
+	 * def unserialize(data) {
+	 *     score = data.readInt()
+	 *     return true
+	 * }
+	 * @endcode
+	 *
+	 * @see serialize
+	 */
+	bool unserialize(ByteData& data);
+
+	/**
+	 * Whether or not the script saves its state with serialize() and unserialize().
+	 */
+	bool hasSerializeCallback();
+
 	/**
 	 * Called when requested to reset the state of all the cheats to their default state.
 	 *
@@ -456,6 +556,54 @@ class script {
 
 	#ifdef __HAVE_CHAISCRIPT__
 	chaiscript::ChaiScript chai;
+
+	/**
+	 * Parses the given module source, reusing the parsed tree when the module is unchanged.
+	 */
+	std::shared_ptr<chaiscript::AST_Node> parseModule(const std::string& code, const std::string& filename);
+
+	/**
+	 * Registers the bindings of each module, which are only registered when the module is enabled in the ModuleConfig.
+	 */
+	void registerAudio();
+	void registerData();
+	void registerEcs();
+	void registerEvent();
+
+	/**
+	 * Registers the constructor and field accessors of the given record type.
+	 */
+	void registerStruct(StructType* type);
+	void registerFilesystem();
+	void registerFont();
+	void registerGraphics();
+	void registerImage();
+	void registerInput();
+	void registerJoystick();
+	void registerKeyboard();
+	void registerMath();
+	void registerMouse();
+	void registerReplay();
+	void registerSound();
+	void registerSystem();
+	void registerTimer();
+	void registerWindow();
+
+	/**
+	 * Registers a type that more than one module uses, the first time one of them asks for it.
+	 */
+	void registerByteDataType();
+	void registerButtonStateType();
+	void registerFontType();
+	void registerImageType();
+	void registerPointType();
+	void registerSoundDataType();
+	void registerVector2Type();
+
+	/**
+	 * Appends the time since the given start to the startup timing breakdown, and restarts the clock.
+	 */
+	void addTiming(const char* name, std::chrono::steady_clock::time_point* start, std::string* timings);
 	std::function<void()> chaiload;
 	std::function<void(config&)> chaiconf;
 	std::function<void(float)> chaiupdate;
@@ -466,6 +614,8 @@ class script {
 	std::function<void()> chaicheatreset;
 	std::function<bool(const std::string&)> chailoadstate;
 	std::function<std::string()> chaisavestate;
+	std::function<void(ByteData&)> chaiserialize;
+	std::function<bool(ByteData&)> chaiunserialize;
 	std::function<void(Joystick*, const std::string&)> chaigamepadpressed;
 	std::function<void(Joystick*, const std::string&)> chaigamepadreleased;
 	std::function<void(Joystick*, int)> chaijoystickpressed;
@@ -475,6 +625,7 @@ class script {
 	std::function<void(int, int, int, int)> chaimousemoved;
 	std::function<void(int, int)> chaiwheelmoved;
 	std::function<void(const std::string&, int)> chaikeypressed;
+	std::function<void(const std::vector<Event>&)> chaievents;
 	std::function<void(const std::string&, int)> chaikeyreleased;
 	bool hasUpdate = true;
 	bool hasDraw = true;
@@ -487,10 +638,13 @@ class script {
 	bool hasmousemoved = true;
 	bool haswheelmoved = true;
 	bool haskeypressed = true;
+	bool hasevents = true;
 	bool haskeyreleased = true;
 	bool hasexit = true;
 	bool hasloadstate = true;
 	bool hassavestate = true;
+	bool hasserialize = true;
+	bool hasunserialize = true;
 	bool hasload = true;
 	bool hasconf = true;
 	bool hasreset = true;
@@ -504,6 +658,32 @@ class script {
 
 	// Properties
 	std::list<std::string> m_requiremodules;
+
+	#ifdef __HAVE_CHAISCRIPT__
+	/**
+	 * A parsed module, along with the hash of the source it was parsed from.
+	 */
+	struct ParsedModule {
+		size_t hash;
+		size_t size;
+		std::shared_ptr<chaiscript::AST_Node> ast;
+	};
+
+	/**
+	 * The parsed modules, keyed by filename, so that loading a module again doesn't parse it again.
+	 */
+	std::map<std::string, ParsedModule> m_parsedmodules;
+	int m_parsedmoduleHits = 0;
+
+	// The record types and field names that have been registered with love.data.newStruct().
+	std::set<std::string> m_structs;
+	std::set<std::string> m_structFields;
+
+	// The types shared between modules that have been registered.
+	std::set<std::string> m_registeredTypes;
+
+	chaiscript::parser::ChaiScript_Parser<chaiscript::eval::Noop_Tracer, chaiscript::optimizer::Optimizer_Default> m_parser;
+	#endif
 };
 
 }  // namespace love
@@ -1,4 +1,5 @@
 #include "timer.h"
+#include "../ChaiLove.h"
 
 namespace love {
 
@@ -8,6 +9,11 @@ void timer::load(pntr_app* app) {
 }
 
 float timer::getDelta() {
+	// Replays run with the recorded frame times.
+	ChaiLove* app = ChaiLove::getInstance();
+	if (app->replay.isPlaying()) {
+		return app->replay.getDelta();
+	}
 	return pntr_app_delta_time(m_app);
 }
 
@@ -9,6 +9,11 @@ void libretro_chailove_pntr_set_error(int error);
 #define PNTR_PHYSFS_IMPLEMENTATION
 #include "pntr_physfs.h"
 
+// Load pntr's files through love.filesystem, so that they can come from its cache.
+unsigned char* libretro_chailove_pntr_load_file(const char* fileName, unsigned int* bytesRead);
+#undef PNTR_LOAD_FILE
+#define PNTR_LOAD_FILE libretro_chailove_pntr_load_file
+
 #define PNTR_APP_IMPLEMENTATION
 #define PNTR_ENABLE_DEFAULT_FONT
 #define PNTR_ENABLE_TTF
@@ -45,6 +50,10 @@ void libretro_chailove_pntr_set_error(int error) {
     }
 }
 
+unsigned char* libretro_chailove_pntr_load_file(const char* fileName, unsigned int* bytesRead) {
+    return ChaiLove::getInstance()->filesystem.loadFile(fileName, bytesRead);
+}
+
 bool Init(pntr_app* app) {
     retro_environment_t environ_cb = pntr_app_libretro_environ_cb(app);
     if (environ_cb == NULL) {
@@ -86,66 +95,30 @@ void Event(pntr_app* app, pntr_app_event* event) {
 
     switch (event->type) {
         case PNTR_APP_EVENTTYPE_KEY_DOWN:
-            chailove->keyboard.eventKeyPressed(event->key);
-        break;
-
         case PNTR_APP_EVENTTYPE_KEY_UP:
-            chailove->keyboard.eventKeyReleased(event->key);
-        break;
-
         case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_DOWN:
-            chailove->mouse.mousepressed(event->mouseX, event->mouseY, chailove->mouse.getButtonName(event->mouseButton));
-        break;
-
         case PNTR_APP_EVENTTYPE_MOUSE_BUTTON_UP:
-            chailove->mouse.mousereleased(event->mouseX, event->mouseY, chailove->mouse.getButtonName(event->mouseButton));
-        break;
-
         case PNTR_APP_EVENTTYPE_MOUSE_MOVE:
-            chailove->mouse.mousemoved(event->mouseX, event->mouseY, event->mouseDeltaX, event->mouseDeltaY);
-        break;
-
         case PNTR_APP_EVENTTYPE_MOUSE_WHEEL:
-            if (event->mouseWheel != 0) {
-                // TODO: Add horizontal mouse wheel to pntr
-                chailove->mouse.wheelmoved(event->mouseWheel, 0);
-            }
-        break;
-
         case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_DOWN:
-            chailove->script->gamepadpressed(chailove->joystick[event->gamepad], chailove->joystick.getButtonName(event->gamepadButton));
-            chailove->script->joystickpressed(chailove->joystick[event->gamepad], event->gamepadButton);
-        break;
-
         case PNTR_APP_EVENTTYPE_GAMEPAD_BUTTON_UP:
-            chailove->script->gamepadreleased(chailove->joystick[event->gamepad], chailove->joystick.getButtonName(event->gamepadButton));
-            chailove->script->joystickreleased(chailove->joystick[event->gamepad], event->gamepadButton);
+            chailove->event.push(event);
         break;
 
-        case PNTR_APP_EVENTTYPE_LOAD: {
-            // Create a string stream from the data.
-            std::stringstream ss(std::string(
-                reinterpret_cast<const char*>(event->save),
-                reinterpret_cast<const char*>(event->save) + event->save_size));
-
-            // Port the string stream to a straight string.
-            std::string loadData = ss.str();
-
-            // Finally, load the string.
-            chailove->loadstate(loadData);
-        }
+        case PNTR_APP_EVENTTYPE_LOAD:
+            // Load the state straight from the frontend's buffer.
+            chailove->unserialize(event->save, event->save_size);
         break;
 
-        case PNTR_APP_EVENTTYPE_SAVE: {
-            // Ask ChaiLove for save data.
-            std::string state = chailove->savestate();
-            if (state.empty()) {
+        case PNTR_APP_EVENTTYPE_SAVE:
+            // Without a buffer, report how large the buffer needs to be.
+            if (event->save == NULL) {
+                event->save_size = chailove->getSerializeSize();
                 return;
             }
 
-            // Save the information to the state data.
-            std::copy(state.begin(), state.end(), (char*)event->save);
-        }
+            // Save the state straight into the frontend's buffer.
+            chailove->serialize(event->save, event->save_size);
         break;
 
         case PNTR_APP_EVENTTYPE_CHEAT: {
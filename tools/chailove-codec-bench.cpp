@@ -0,0 +1,233 @@
+/**
+ * chailove-codec-bench
+ *
+ * Checks and times the base64 and hex codecs behind love.data.encode and love.data.decode.
+ *
+ * The codecs are compared against a scalar reference that builds its output one character at a time, like the cppcodec path they replaced. Every size from 0 to 299 bytes is checked first, including unpadded base64 and invalid input, then each codec is timed on a buffer of random bytes.
+ *
+ * @code
+ * make chailove-codec-bench
+ * ./chailove-codec-bench 16
+ * @endcode
+ */
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/love/Types/Data/Base64.h"
+#include "../src/love/Types/Data/Hex.h"
+
+using love::Types::Data::Base64;
+using love::Types::Data::Hex;
+
+namespace {
+
+const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char hexAlphabet[] = "0123456789abcdef";
+
+/**
+ * Encodes to base64 one character at a time.
+ */
+std::string referenceBase64Encode(const std::string& input) {
+	const uint8_t* source = reinterpret_cast<const uint8_t*>(input.data());
+	size_t size = input.size();
+	std::string output;
+	size_t i = 0;
+	for (; i + 3 <= size; i += 3) {
+		output.push_back(base64Alphabet[source[i] >> 2]);
+		output.push_back(base64Alphabet[((source[i] & 3) << 4) | (source[i + 1] >> 4)]);
+		output.push_back(base64Alphabet[((source[i + 1] & 15) << 2) | (source[i + 2] >> 6)]);
+		output.push_back(base64Alphabet[source[i + 2] & 63]);
+	}
+	if (size - i == 1) {
+		output.push_back(base64Alphabet[source[i] >> 2]);
+		output.push_back(base64Alphabet[(source[i] & 3) << 4]);
+		output += "==";
+	} else if (size - i == 2) {
+		output.push_back(base64Alphabet[source[i] >> 2]);
+		output.push_back(base64Alphabet[((source[i] & 3) << 4) | (source[i + 1] >> 4)]);
+		output.push_back(base64Alphabet[(source[i + 1] & 15) << 2]);
+		output += "=";
+	}
+	return output;
+}
+
+/**
+ * Decodes base64 one character at a time into a vector, then copies it into a string.
+ */
+bool referenceBase64Decode(const std::string& input, std::string* output) {
+	std::vector<unsigned char> bytes;
+	uint32_t buffer = 0;
+	int bits = 0;
+	for (char c : input) {
+		if (c == '=') {
+			break;
+		}
+		const char* position = std::char_traits<char>::find(base64Alphabet, 64, c);
+		if (position == NULL) {
+			return false;
+		}
+		buffer = (buffer << 6) | static_cast<uint32_t>(position - base64Alphabet);
+		bits += 6;
+		if (bits >= 8) {
+			bits -= 8;
+			bytes.push_back(static_cast<unsigned char>(buffer >> bits));
+		}
+	}
+	output->assign(bytes.begin(), bytes.end());
+	return true;
+}
+
+/**
+ * Encodes to hex one character at a time.
+ */
+std::string referenceHexEncode(const std::string& input) {
+	std::string output;
+	for (unsigned char c : input) {
+		output.push_back(hexAlphabet[c >> 4]);
+		output.push_back(hexAlphabet[c & 15]);
+	}
+	return output;
+}
+
+/**
+ * Decodes hex one character at a time.
+ */
+bool referenceHexDecode(const std::string& input, std::string* output) {
+	output->clear();
+	if (input.size() % 2 != 0) {
+		return false;
+	}
+	for (size_t i = 0; i < input.size(); i += 2) {
+		const char* high = std::char_traits<char>::find(hexAlphabet, 16, static_cast<char>(tolower(input[i])));
+		const char* low = std::char_traits<char>::find(hexAlphabet, 16, static_cast<char>(tolower(input[i + 1])));
+		if (high == NULL || low == NULL) {
+			return false;
+		}
+		output->push_back(static_cast<char>(((high - hexAlphabet) << 4) | (low - hexAlphabet)));
+	}
+	return true;
+}
+
+std::string base64Encode(const std::string& input) {
+	std::string output(Base64::getEncodedSize(input.size()), '\0');
+	Base64::encode(reinterpret_cast<const uint8_t*>(input.data()), input.size(), &output[0]);
+	return output;
+}
+
+bool base64Decode(const std::string& input, std::string* output) {
+	output->assign(Base64::getDecodedSize(input.size()), '\0');
+	size_t size = 0;
+	if (!Base64::decode(input.data(), input.size(), reinterpret_cast<uint8_t*>(&(*output)[0]), &size)) {
+		return false;
+	}
+	output->resize(size);
+	return true;
+}
+
+std::string hexEncode(const std::string& input) {
+	std::string output(input.size() * 2, '\0');
+	Hex::encode(reinterpret_cast<const uint8_t*>(input.data()), input.size(), &output[0]);
+	return output;
+}
+
+bool hexDecode(const std::string& input, std::string* output) {
+	output->assign(input.size() / 2, '\0');
+	return Hex::decode(input.data(), input.size(), reinterpret_cast<uint8_t*>(&(*output)[0]));
+}
+
+/**
+ * Counts a failed check.
+ */
+void check(bool passed, const std::string& name, size_t size, int* failures) {
+	if (!passed) {
+		std::cerr << "[chailove-codec-bench] " << name << " failed for " << size << " bytes" << std::endl;
+		(*failures)++;
+	}
+}
+
+/**
+ * Gets the average time the given function takes, in milliseconds.
+ */
+template<typename Function>
+double measure(Function function) {
+	const int runs = 5;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < runs; i++) {
+		function();
+	}
+	std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / runs;
+}
+
+void report(const std::string& name, double reference, double current) {
+	std::cout << "[chailove-codec-bench] " << name << ": reference " << reference << " ms, current " << current << " ms (" << reference / current << "x)" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+	size_t megabytes = argc > 1 ? std::strtoul(argv[1], NULL, 10) : 16;
+	if (megabytes == 0) {
+		std::cerr << "Usage: " << argv[0] << " [<megabytes>]" << std::endl;
+		return 1;
+	}
+
+	// Check every size, to cover each tail of the vectorized loops.
+	std::mt19937 random(1);
+	int failures = 0;
+	std::string decoded;
+	for (size_t size = 0; size < 300; size++) {
+		std::string input(size, '\0');
+		for (char& c : input) {
+			c = static_cast<char>(random());
+		}
+
+		std::string encoded = base64Encode(input);
+		check(encoded == referenceBase64Encode(input), "base64 encode", size, &failures);
+		check(base64Decode(encoded, &decoded) && decoded == input, "base64 decode", size, &failures);
+		std::string unpadded = encoded.substr(0, encoded.find('='));
+		check(base64Decode(unpadded, &decoded) && decoded == input, "unpadded base64 decode", size, &failures);
+
+		std::string hex = hexEncode(input);
+		check(hex == referenceHexEncode(input), "hex encode", size, &failures);
+		check(hexDecode(hex, &decoded) && decoded == input, "hex decode", size, &failures);
+		check(referenceHexDecode(hex, &decoded) && decoded == input, "reference hex decode", size, &failures);
+		check(referenceBase64Decode(encoded, &decoded) && decoded == input, "reference base64 decode", size, &failures);
+	}
+	check(!base64Decode("YW5!", &decoded), "invalid base64", 4, &failures);
+	check(!base64Decode("Y", &decoded), "truncated base64", 1, &failures);
+	check(!hexDecode("zz", &decoded), "invalid hex", 2, &failures);
+	if (failures > 0) {
+		return 1;
+	}
+	std::cout << "[chailove-codec-bench] All checks passed" << std::endl;
+
+	// Time each codec against the reference.
+	std::string input(megabytes << 20, '\0');
+	for (char& c : input) {
+		c = static_cast<char>(random());
+	}
+	std::string base64 = base64Encode(input);
+	std::string hex = hexEncode(input);
+	volatile size_t sink = 0;
+	std::cout << "[chailove-codec-bench] " << megabytes << " MB of random bytes" << std::endl;
+	report("base64 encode",
+		measure([&] { sink += referenceBase64Encode(input).size(); }),
+		measure([&] { sink += base64Encode(input).size(); }));
+	report("base64 decode",
+		measure([&] { referenceBase64Decode(base64, &decoded); sink += decoded.size(); }),
+		measure([&] { base64Decode(base64, &decoded); sink += decoded.size(); }));
+	report("hex encode",
+		measure([&] { sink += referenceHexEncode(input).size(); }),
+		measure([&] { sink += hexEncode(input).size(); }));
+	report("hex decode",
+		measure([&] { referenceHexDecode(hex, &decoded); sink += decoded.size(); }),
+		measure([&] { hexDecode(hex, &decoded); sink += decoded.size(); }));
+
+	return 0;
+}
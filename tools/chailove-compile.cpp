@@ -0,0 +1,167 @@
+/**
+ * chailove-compile
+ *
+ * Precompiles ChaiScript modules into `.chaic` files, which ChaiLove prefers over the `.chai` source when loading a module.
+ *
+ * A precompiled module is still ChaiScript, but with comments, indentation and redundant whitespace removed, and tabs already replaced. This makes the module smaller to read from slow storage, and leaves less for the parser to tokenize. Line breaks are kept, so line numbers in error messages still match the original source. The line breaks within a block comment are moved to the end of its line, as they could otherwise end a statement early.
+ *
+ * @code
+ * make chailove-compile
+ * ./chailove-compile main.chai Player.chai
+ * zip -9 -r MyGame.chailove *.chaic assets
+ * @endcode
+ */
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+/**
+ * Copies a string literal, starting at the opening quote, including any nested strings within `${}` interpolations.
+ */
+size_t copyString(const std::string& input, size_t pos, std::string* output) {
+	char quote = input[pos];
+	output->push_back(input[pos++]);
+	int interpolation = 0;
+	while (pos < input.size()) {
+		char c = input[pos];
+		if (interpolation > 0) {
+			if (c == '"' || c == '\'') {
+				pos = copyString(input, pos, output);
+				continue;
+			}
+			if (c == '{') {
+				interpolation++;
+			} else if (c == '}') {
+				interpolation--;
+			}
+		} else if (c == '\\' && pos + 1 < input.size()) {
+			output->push_back(input[pos++]);
+		} else if (quote == '"' && c == '$' && pos + 1 < input.size() && input[pos + 1] == '{') {
+			output->push_back(input[pos++]);
+			interpolation++;
+		} else if (c == quote) {
+			output->push_back(input[pos++]);
+			return pos;
+		}
+		output->push_back(input[pos++]);
+	}
+	return pos;
+}
+
+/**
+ * Whether or not the given character may be part of an identifier or number.
+ */
+bool isWord(char c) {
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+/**
+ * Whether or not a space is needed between the two given characters to keep them as separate tokens.
+ */
+bool needsSpace(char previous, char next) {
+	static const std::string separators("(){}[],;");
+	if (separators.find(previous) != std::string::npos || separators.find(next) != std::string::npos) {
+		return false;
+	}
+	return isWord(previous) == isWord(next);
+}
+
+/**
+ * Strips comments and redundant whitespace from the given ChaiScript source.
+ */
+std::string compile(const std::string& input) {
+	std::string output;
+	output.reserve(input.size());
+	bool pendingSpace = false;
+	size_t pendingLines = 0;
+	size_t pos = 0;
+	while (pos < input.size()) {
+		char c = input[pos];
+		if (c == '"' || c == '\'') {
+			if (pendingSpace && !output.empty() && isWord(output.back())) {
+				output.push_back(' ');
+			}
+			pendingSpace = false;
+			pos = copyString(input, pos, &output);
+		} else if (c == '/' && pos + 1 < input.size() && input[pos + 1] == '/') {
+			// Line comments are dropped up to the line break.
+			while (pos < input.size() && input[pos] != '\n') {
+				pos++;
+			}
+		} else if (c == '/' && pos + 1 < input.size() && input[pos + 1] == '*') {
+			// Block comments are dropped, and their line breaks are kept for the end of the line.
+			pos += 2;
+			while (pos < input.size() && !(input[pos] == '*' && pos + 1 < input.size() && input[pos + 1] == '/')) {
+				if (input[pos] == '\n') {
+					pendingLines++;
+				}
+				pos++;
+			}
+			pos += 2;
+			pendingSpace = true;
+		} else if (c == ' ' || c == '\t' || c == '\r') {
+			pendingSpace = true;
+			pos++;
+		} else if (c == '\n') {
+			output.append(pendingLines + 1, '\n');
+			pendingLines = 0;
+			pendingSpace = false;
+			pos++;
+		} else {
+			// Only keep a single space where it separates two tokens that could otherwise merge.
+			if (pendingSpace && !output.empty() && output.back() != '\n' && needsSpace(output.back(), c)) {
+				output.push_back(' ');
+			}
+			pendingSpace = false;
+			output.push_back(input[pos++]);
+		}
+	}
+	output.append(pendingLines, '\n');
+	return output;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+	if (argc < 2) {
+		std::cerr << "Usage: " << argv[0] << " <module.chai> [<module.chai> ...]" << std::endl;
+		return 1;
+	}
+
+	int failures = 0;
+	for (int i = 1; i < argc; i++) {
+		std::string filename(argv[i]);
+		std::ifstream input(filename, std::ios::binary);
+		if (!input) {
+			std::cerr << "[chailove-compile] Could not read " << filename << std::endl;
+			failures++;
+			continue;
+		}
+		std::stringstream buffer;
+		buffer << input.rdbuf();
+		std::string source = buffer.str();
+
+		// Write the precompiled module next to the source.
+		std::string destination(filename);
+		size_t extension = destination.rfind(".chai");
+		if (extension != std::string::npos && extension == destination.size() - 5) {
+			destination.erase(extension);
+		}
+		destination += ".chaic";
+
+		std::string compiled = compile(source);
+		std::ofstream output(destination, std::ios::binary);
+		output << compiled;
+		if (!output) {
+			std::cerr << "[chailove-compile] Could not write " << destination << std::endl;
+			failures++;
+			continue;
+		}
+		std::cout << "[chailove-compile] " << filename << " -> " << destination << " (" << source.size() << " -> " << compiled.size() << " bytes)" << std::endl;
+	}
+
+	return failures == 0 ? 0 : 1;
+}